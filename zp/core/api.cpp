@@ -46,6 +46,7 @@ enum struct ForwardData
     Handle OnClientDeath;
     Handle OnClientRespawn;
     Handle OnClientDamaged;
+    Handle OnClientDamagedBatch;
     Handle OnClientValidateDamage;
     Handle OnClientValidateItem;
     Handle OnClientBuyItem;
@@ -75,6 +76,13 @@ enum struct ForwardData
     Handle OnGameModeEnd;
     Handle OnEngineExecute;
     
+    /* Damage */
+    Handle OnClientDamagedList;
+    ArrayList DamagedBatch;
+    int DamagedCount;
+    int DamagedDepth;
+    bool DamagedDirty;
+    
     /**
      * @brief Initializes all forwards.
      **/
@@ -83,7 +91,8 @@ enum struct ForwardData
         this.OnClientUpdated         = CreateGlobalForward("ZP_OnClientUpdated", ET_Ignore, Param_Cell, Param_Cell);
         this.OnClientDeath           = CreateGlobalForward("ZP_OnClientDeath", ET_Ignore, Param_Cell, Param_Cell);
         this.OnClientRespawn         = CreateGlobalForward("ZP_OnClientRespawn", ET_Hook, Param_Cell);
-        this.OnClientDamaged         = CreateGlobalForward("ZP_OnClientDamaged", ET_Ignore, Param_Cell, Param_Cell, Param_Cell, Param_Float, Param_Cell, Param_Cell, Param_Cell, Param_Cell); 
+        this.OnClientDamaged         = CreateForward(ET_Ignore, Param_Cell, Param_Cell, Param_Cell, Param_Float, Param_Cell, Param_Cell, Param_Cell, Param_Cell); 
+        this.OnClientDamagedBatch    = CreateForward(ET_Ignore, Param_Array, Param_Array, Param_Array, Param_Array, Param_Array, Param_Array, Param_Cell);
         this.OnClientValidateDamage  = CreateGlobalForward("ZP_OnClientValidateDamage", ET_Ignore, Param_Cell, Param_CellByRef, Param_CellByRef, Param_FloatByRef, Param_CellByRef, Param_CellByRef);
         this.OnClientValidateItem    = CreateGlobalForward("ZP_OnClientValidateExtraItem", ET_Hook, Param_Cell, Param_Cell);
         this.OnClientBuyItem         = CreateGlobalForward("ZP_OnClientBuyExtraItem", ET_Ignore, Param_Cell, Param_Cell);
@@ -112,6 +121,56 @@ enum struct ForwardData
         this.OnGameModeStart         = CreateGlobalForward("ZP_OnGameModeStart", ET_Ignore, Param_Cell);
         this.OnGameModeEnd           = CreateGlobalForward("ZP_OnGameModeEnd", ET_Ignore, Param_Cell);
         this.OnEngineExecute         = CreateGlobalForward("ZP_OnEngineExecute", ET_Ignore);
+        
+        /// Never called, only counts the plugins which have the per-hit public
+        this.OnClientDamagedList     = CreateGlobalForward("ZP_OnClientDamaged", ET_Ignore, Param_Cell, Param_Cell, Param_Cell, Param_Float, Param_Cell, Param_Cell, Param_Cell, Param_Cell);
+        this.DamagedBatch            = new ArrayList();
+    }
+    
+    /**
+     * @brief Adds loaded plugins to the per-hit damage forward, except ones registered for the batched forward.
+     **/
+    void _OnClientDamagedSync()
+    {
+        // If forward is running or plugins weren't changed, then stop
+        int iCount = GetForwardFunctionCount(this.OnClientDamagedList);
+        if (this.DamagedDepth || (!this.DamagedDirty && iCount == this.DamagedCount))
+        {
+            return;
+        }
+        
+        // Update state
+        this.DamagedCount = iCount;
+        this.DamagedDirty = false;
+        
+        // i = plugin index
+        Handle hIterator = GetPluginIterator();
+        while (MorePlugins(hIterator))
+        {
+            // Validate plugin
+            Handle hPlugin = ReadPlugin(hIterator);
+            if (GetPluginStatus(hPlugin) != Plugin_Running)
+            {
+                continue;
+            }
+            
+            // Validate callback
+            Function hCallback = GetFunctionByName(hPlugin, "ZP_OnClientDamaged");
+            if (hCallback == INVALID_FUNCTION)
+            {
+                continue;
+            }
+            
+            // Readd the plugin, unless it was registered for the batch
+            RemoveFromForward(this.OnClientDamaged, hPlugin, hCallback);
+            if (this.DamagedBatch.FindValue(hPlugin) == -1)
+            {
+                AddToForward(this.OnClientDamaged, hPlugin, hCallback);
+            }
+        }
+        
+        // Close iterator
+        delete hIterator;
     }
     
     /**
@@ -171,6 +230,16 @@ enum struct ForwardData
      **/
     void _OnClientDamaged(int client, int attacker, int inflictor, float flDamage, int iBits, int weapon, int iHealth, int iArmor)
     {
+        // Adds new plugins
+        this._OnClientDamagedSync();
+        
+        // Validate subscribers
+        if (!GetForwardFunctionCount(this.OnClientDamaged))
+        {
+            return;
+        }
+        
+        this.DamagedDepth++;
         Call_StartForward(this.OnClientDamaged);
         Call_PushCell(client);
         Call_PushCell(attacker);
@@ -181,6 +250,31 @@ enum struct ForwardData
         Call_PushCell(iHealth);
         Call_PushCell(iArmor);
         Call_Finish();
+        this.DamagedDepth--;
+    }
+
+    /**
+     * @brief Called once per frame with all fake damage taken since the last frame.
+     * 
+     * @param victims           The array of victim indexes.
+     * @param attackers         The array of attacker indexes.
+     * @param inflictors        The array of inflictor indexes.
+     * @param damages           The array of damage amounts.
+     * @param bits              The array of damage types.
+     * @param weapons           The array of weapon indexes.
+     * @param iCount            The amount of hits in the arrays.
+     **/
+    void _OnClientDamagedBatch(any[] victims, any[] attackers, any[] inflictors, any[] damages, any[] bits, any[] weapons, int iCount)
+    {
+        Call_StartForward(this.OnClientDamagedBatch);
+        Call_PushArray(victims, iCount);
+        Call_PushArray(attackers, iCount);
+        Call_PushArray(inflictors, iCount);
+        Call_PushArray(damages, iCount);
+        Call_PushArray(bits, iCount);
+        Call_PushArray(weapons, iCount);
+        Call_PushCell(iCount);
+        Call_Finish();
     }
 
     /**
@@ -197,6 +291,12 @@ enum struct ForwardData
      **/
     void _OnClientValidateDamage(int client, int &attacker, int &inflictor, float &flDamage, int &iBits, int &weapon)
     {
+        // Validate subscribers
+        if (!GetForwardFunctionCount(this.OnClientValidateDamage))
+        {
+            return;
+        }
+        
         Call_StartForward(this.OnClientValidateDamage);
         Call_PushCell(client);
         Call_PushCellRef(attacker);
@@ -249,6 +349,13 @@ enum struct ForwardData
      **/
     void _OnClientValidateClass(int client, int class, Action &hResult)
     {
+        // Disable classes removed by a reload
+        if (ClassIsRemoved(class))
+        {
+            hResult = Plugin_Stop;
+            return;
+        }
+        
         Call_StartForward(this.OnClientValidateClass);
         Call_PushCell(client);
         Call_PushCell(class);
@@ -283,6 +390,13 @@ enum struct ForwardData
      **/
     void _OnClientValidateWeapon(int client, int weapon, Action &hResult)
     {
+        // Disable weapons removed by a reload
+        if (WeaponsIsRemoved(weapon))
+        {
+            hResult = Plugin_Stop;
+            return;
+        }
+        
         Call_StartForward(this.OnClientValidateWeapon);
         Call_PushCell(client);
         Call_PushCell(weapon);
@@ -666,6 +780,24 @@ APLRes APIOnInit(/*void*/)
     return APLRes_Success;
 }
 
+/**
+ * @brief Called when a plugin is unloaded.
+ *
+ * @param hPlugin           The plugin handle.
+ **/
+void APIOnPluginUnloaded(Handle hPlugin)
+{
+    // Remove plugin from the batch list
+    int iIndex = gForwardData.DamagedBatch.FindValue(hPlugin);
+    if (iIndex != -1)
+    {
+        gForwardData.DamagedBatch.Erase(iIndex);
+    }
+    
+    /// A reloaded plugin keeps the same count, so the forward is rebuilt anyway
+    gForwardData.DamagedDirty = true;
+}
+
 /**
  * @brief Initializes all natives.
  **/
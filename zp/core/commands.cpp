@@ -33,7 +33,10 @@ void CommandsOnInit(/*void*/)
     // Forward event to modules
     DebugOnCommandInit();
     ConfigOnCommandInit();
+    GameEngineOnCommandInit();
+    DecryptOnCommandInit();
     LogOnCommandInit();
+    DataBaseOnCommandInit();
     DeathOnCommandInit();
     SpawnOnCommandInit();
     MenusOnCommandInit();
@@ -41,6 +44,7 @@ void CommandsOnInit(/*void*/)
     ClassesOnCommandInit();
     WeaponsOnCommandInit();
     GameModesOnCommandInit();
+    HitGroupsOnCommandInit();
     ExtraItemsOnCommandInit();
     CostumesOnCommandInit();
     VersionOnCommandInit();
@@ -158,6 +158,19 @@ enum /*ConfigFile*/
  * @endsection
  **/
 
+/**
+ * @section States of config entries after an incremental reload.
+ **/
+enum ConfigEntryState
+{
+    EntryState_Parse,             /** Entry is new or changed and has to be cached. */
+    EntryState_Keep,              /** Entry is unchanged and keeps its cached data. */
+    EntryState_Removed            /** Entry is missing in the file and keeps its data disabled. */
+};
+/**
+ * @endsection
+ **/
+
 /**
  * @section Struct of operation types for config arrays.
  **/
@@ -169,6 +182,17 @@ enum struct ConfigData
     ArrayList Handler;               /** Handle of the config file. */
     char Path[PLATFORM_LINE_LENGTH]; /** Full path to config file. */
     char Alias[NORMAL_LINE_LENGTH];  /** Config file alias, used for client interaction. */
+    KeyValues Cache;                 /** Parsed keyvalue tree of the config file. */
+    char CachePath[PLATFORM_LINE_LENGTH]; /** Full path of the parsed file. */
+    int CacheSize;                   /** Size of the parsed file. */
+    int CacheTime;                   /** Last change time of the parsed file. */
+    int Parses;                      /** Amount of the file parses. */
+    int Hits;                        /** Amount of the cache hits. */
+    float ParseTime;                 /** Total time of the file parses. */
+    float HitTime;                   /** Total time of the cache hits. */
+    bool Incremental;                /** True if reloads patch the entries in place. */
+    bool Reloading;                  /** True while the reload function is called. */
+    ArrayList State;                 /** States of the entries after an incremental reload. */
 }
 /**
  * @endsection
@@ -353,6 +377,8 @@ void ConfigOnCommandInit(/*void*/)
     RegConsoleCmd("zp_config_menu", ConfigMenuOnCommandCatched, "Opens the configs menu.");
     RegAdminCmd("zp_config_reload", ConfigReloadOnCommandCatched, ADMFLAG_CONFIG, "Reloads a config file. Usage: zp_config_reload <file alias>");
     RegAdminCmd("zp_config_reloadall", ConfigReloadAllOnCommandCatched, ADMFLAG_CONFIG, "Reloads all config files. Usage: zp_config_reloadall");
+    RegAdminCmd("zp_config_cache_stats", ConfigCacheOnCommandCatched, ADMFLAG_CONFIG, "Prints the parse time against the cache time of keyvalue configs. Usage: zp_config_cache_stats");
+    RegAdminCmd("zp_config_parse_bench", ConfigParseOnCommandCatched, ADMFLAG_CONFIG, "Measures the span parser against the old ExplodeString parser over the shipped config lines. Blocks the server while running. Usage: zp_config_parse_bench [passes]");
 }
 
 /*
@@ -414,6 +440,20 @@ stock void ConfigSetConfigReloadFunc(int iConfig, Function iReloadfunc)
     gConfigData[iConfig].ReloadFunc = iReloadfunc;
 }
 
+/**
+ * @brief Sets the incremental reload of a config file entry.
+ * 
+ * @note Only for keyvalue configs which cache data with ConfigGetEntryState.
+ * 
+ * @param iConfig           Config file to set reload mode of.
+ * @param bIncremental      True to patch entries by name on reload, false to rebuild them.
+ **/
+stock void ConfigSetConfigIncremental(int iConfig, bool bIncremental)
+{
+    // Sets reload mode
+    gConfigData[iConfig].Incremental = bIncremental;
+}
+
 /**
  * @brief Sets the file handle of a config file entry.
  * 
@@ -486,6 +526,39 @@ stock Function ConfigGetConfigReloadFunc(int iConfig)
     return gConfigData[iConfig].ReloadFunc;
 }
 
+/**
+ * @brief Returns the state of a config entry after the last load.
+ * 
+ * @param iConfig           Config file to get entry state of.
+ * @param iD                The entry index.
+ * @return                  The entry state.
+ **/
+stock ConfigEntryState ConfigGetEntryState(int iConfig, int iD)
+{
+    // Validate states of incremental reload
+    ArrayList hState = gConfigData[iConfig].State;
+    if (hState == null || iD < 0 || iD >= hState.Length)
+    {
+        return EntryState_Parse;
+    }
+    
+    // Return entry state
+    return hState.Get(iD);
+}
+
+/**
+ * @brief Returns true if a config entry was removed from the file by an incremental reload.
+ * 
+ * @param iConfig           Config file to get entry state of.
+ * @param iD                The entry index.
+ * @return                  True if entry is removed, false otherwise.
+ **/
+stock bool ConfigIsEntryRemoved(int iConfig, int iD)
+{
+    // Return entry state
+    return ConfigGetEntryState(iConfig, iD) == EntryState_Removed;
+}
+
 /**
  * @brief Returns config file handle.
  * 
@@ -677,6 +750,12 @@ stock bool ConfigLoadConfig(int iConfig, ArrayList &arrayConfig, int blockSize =
         
         case Structure_Keyvalue :
         {
+            // Validate incremental reload
+            if (gConfigData[iConfig].Incremental && gConfigData[iConfig].Reloading && arrayConfig.Length)
+            {
+                return ConfigPatchConfig(iConfig, arrayConfig, blockSize);
+            }
+            
             // Opens file
             KeyValues hKeyvalue;
             bool bSuccess = ConfigOpenConfigFile(iConfig, hKeyvalue);
@@ -689,6 +768,7 @@ stock bool ConfigLoadConfig(int iConfig, ArrayList &arrayConfig, int blockSize =
             
             // Destroy all old data
             ConfigClearKvArray(arrayConfig);
+            delete gConfigData[iConfig].State;
             
             // Read keys in the file
             if (hKeyvalue.GotoFirstSubKey())
@@ -743,13 +823,233 @@ stock bool ConfigReloadConfig(int iConfig)
     Function iReloadfunc = ConfigGetConfigReloadFunc(iConfig);
     
     // Call reload function
+    gConfigData[iConfig].Reloading = true;
     Call_StartFunction(GetMyHandle(), iReloadfunc);
     Call_Finish();
+    gConfigData[iConfig].Reloading = false;
 
     // Return on success
     return true;
 }
 
+/**
+ * @brief Patches the entries of a keyvalue config by name instead of rebuilding them.
+ * 
+ * @note Unchanged entries keep their data, changed entries are cut to the name
+ *       to be cached again, new entries are appended and missing ones are marked removed.
+ *       So entry indexes stay valid for the players and sub-plugins.
+ *       Duplicate names are matched by their position among the same names.
+ * 
+ * @param iConfig           The config file to patch.
+ * @param arrayConfig       Handle of the main array containing file data.
+ * @param blockSize         The number of cells each member of the array can hold. 
+ * @return                  True if file was loaded successfuly, false otherwise.
+ **/
+stock bool ConfigPatchConfig(int iConfig, ArrayList arrayConfig, int blockSize)
+{
+    // Take the previous tree out of the cache to compare with the file
+    KeyValues hPrevious = gConfigData[iConfig].Cache;
+    gConfigData[iConfig].Cache = null;
+    
+    // Opens file
+    KeyValues hKeyvalue;
+    bool bSuccess = ConfigOpenConfigFile(iConfig, hKeyvalue);
+    
+    // If config file failed to open, then stop
+    if (!bSuccess)
+    {
+        // Restore the previous tree
+        gConfigData[iConfig].Cache = hPrevious;
+        delete hKeyvalue;
+        return false;
+    }
+    
+    // If array hasn't been created, then create
+    if (gConfigData[iConfig].State == null)
+    {
+        // Initialize a state array
+        gConfigData[iConfig].State = new ArrayList();
+    }
+    else
+    {
+        // Clear out the array of all data
+        gConfigData[iConfig].State.Clear();
+    }
+    
+    // Initialize name maps
+    StringMap hNames = new StringMap(); StringMap hCounts = new StringMap();
+    static char sKeyName[NORMAL_LINE_LENGTH]; static char sKey[NORMAL_LINE_LENGTH + SMALL_LINE_LENGTH]; int iCount;
+    
+    // i = array index
+    int iSize = arrayConfig.Length;
+    for (int i = 0; i < iSize; i++)
+    {
+        // Gets entry name
+        ArrayList arrayConfigEntry = arrayConfig.Get(i);
+        arrayConfigEntry.GetString(0, sKeyName, sizeof(sKeyName));
+        
+        // Gets position among the same names
+        iCount = 0; hCounts.GetValue(sKeyName, iCount);
+        hCounts.SetValue(sKeyName, iCount + 1);
+        
+        // Mark entry as missing, until it found in the file
+        FormatEx(sKey, sizeof(sKey), "%s:%d", sKeyName, iCount);
+        hNames.SetValue(sKey, i);
+        gConfigData[iConfig].State.Push(EntryState_Removed);
+    }
+    
+    // Clear positions for the file
+    hCounts.Clear();
+    
+    // Read keys in the file
+    if (hKeyvalue.GotoFirstSubKey())
+    {
+        do
+        {
+            // Gets the key name
+            hKeyvalue.GetSectionName(sKeyName, sizeof(sKeyName));
+
+            // Converts uppercase chars
+            StringToLower(sKeyName);
+            
+            // Gets position among the same names
+            iCount = 0; hCounts.GetValue(sKeyName, iCount);
+            hCounts.SetValue(sKeyName, iCount + 1);
+            
+            // Validate existing entry, extra duplicates are appended as on the full load
+            int iD; FormatEx(sKey, sizeof(sKey), "%s:%d", sKeyName, iCount);
+            if (hNames.GetValue(sKey, iD))
+            {
+                // Entry was found
+                hNames.Remove(sKey);
+                
+                // Compare section with the same position in the previous tree
+                bool bSame = false;
+                if (hPrevious != null)
+                {
+                    bSame = ConfigKvJumpToKey(hPrevious, sKeyName, iCount) && ConfigKvCompare(hKeyvalue, hPrevious);
+                }
+                
+                // Validate changes
+                if (bSame)
+                {
+                    // Keep cached data
+                    gConfigData[iConfig].State.Set(iD, EntryState_Keep);
+                }
+                else
+                {
+                    // Cut entry to the name
+                    ArrayList arrayConfigEntry = arrayConfig.Get(iD);
+                    arrayConfigEntry.Resize(1);
+                    gConfigData[iConfig].State.Set(iD, EntryState_Parse);
+                }
+            }
+            else
+            {
+                // Creates new array to store information for config entry
+                ArrayList arrayConfigEntry = new ArrayList(blockSize);
+                arrayConfigEntry.PushString(sKeyName); // Index: 0
+                
+                // Store this handle in the main array
+                arrayConfig.Push(arrayConfigEntry);
+                gConfigData[iConfig].State.Push(EntryState_Parse);
+            }
+        } 
+        while (hKeyvalue.GotoNextKey());
+    }
+    
+    // We're done with these now, so we can close them
+    delete hNames;
+    delete hCounts;
+    delete hPrevious;
+    delete hKeyvalue;
+    return true;
+}
+
+/**
+ * @brief Jumps to a section of the root by its name and position among the same names.
+ * 
+ * @param kv                The keyvalue handle.
+ * @param sKeyName          The section name.
+ * @param iCount            The position among the same names.
+ * @return                  True if section was found, false otherwise.
+ **/
+stock bool ConfigKvJumpToKey(KeyValues kv, char[] sKeyName, int iCount)
+{
+    // Initialize buffer char
+    static char sName[NORMAL_LINE_LENGTH];
+    
+    // Read keys in the root
+    kv.Rewind();
+    if (kv.GotoFirstSubKey())
+    {
+        do
+        {
+            // Validate name and position
+            kv.GetSectionName(sName, sizeof(sName));
+            if (!strcmp(sName, sKeyName, false) && !iCount--)
+            {
+                return true;
+            }
+        } 
+        while (kv.GotoNextKey());
+    }
+    
+    // Section wasn't found
+    return false;
+}
+
+/**
+ * @brief Compares the subkeys at the current positions of two keyvalue trees.
+ * 
+ * @note Both trees are returned to their current positions.
+ * 
+ * @param kvFirst           The first keyvalue handle.
+ * @param kvSecond          The second keyvalue handle.
+ * @return                  True if names and values of the subkeys are equal, false otherwise.
+ **/
+stock bool ConfigKvCompare(KeyValues kvFirst, KeyValues kvSecond)
+{
+    // Initialize buffer chars
+    static char sFirst[PLATFORM_LINE_LENGTH]; static char sSecond[PLATFORM_LINE_LENGTH];
+    
+    // Jump into subkeys
+    bool bFirst = kvFirst.GotoFirstSubKey(false);
+    bool bSecond = kvSecond.GotoFirstSubKey(false);
+    bool bEqual = (bFirst == bSecond); bool bNext = bFirst;
+    
+    // Walk both levels at once
+    while (bEqual && bNext)
+    {
+        // Compare key names
+        kvFirst.GetSectionName(sFirst, sizeof(sFirst));
+        kvSecond.GetSectionName(sSecond, sizeof(sSecond));
+        if (strcmp(sFirst, sSecond, false) || !ConfigKvCompare(kvFirst, kvSecond))
+        {
+            bEqual = false;
+            break;
+        }
+        
+        // Compare key values
+        kvFirst.GetString(NULL_STRING, sFirst, sizeof(sFirst));
+        kvSecond.GetString(NULL_STRING, sSecond, sizeof(sSecond));
+        if (strcmp(sFirst, sSecond))
+        {
+            bEqual = false;
+            break;
+        }
+        
+        // Move to the next keys
+        bNext = kvFirst.GotoNextKey(false);
+        bEqual = (bNext == kvSecond.GotoNextKey(false));
+    }
+    
+    // Return to the current positions
+    if (bFirst) kvFirst.GoBack();
+    if (bSecond) kvSecond.GoBack();
+    return bEqual;
+}
+
 /**
  * @brief Opens a config file with appropriate method.
  * 
@@ -777,7 +1077,7 @@ stock bool ConfigOpenConfigFile(int iConfig, Handle &hConfig)
         {
             // Creates config
             hConfig = CreateKeyValues(sConfigAlias);
-            return FileToKeyValues(hConfig, sConfigPath);
+            return ConfigOpenKvCache(iConfig, view_as<KeyValues>(hConfig), sConfigPath);
         }
         
         default :
@@ -797,6 +1097,74 @@ stock bool ConfigOpenConfigFile(int iConfig, Handle &hConfig)
     }
 }
 
+/**
+ * @brief Fills a keyvalue tree from the parsed copy of a config file.
+ * 
+ * @note The file is parsed only when its path, size or last change time differs
+ *       from the cached tree, otherwise the cached tree is copied.
+ * 
+ * @param iConfig           The config file.
+ * @param kv                The keyvalue handle to fill.
+ * @param sPath             The full path to the config file.
+ * @return                  True if the tree was filled, false otherwise.
+ **/
+stock bool ConfigOpenKvCache(int iConfig, KeyValues kv, char[] sPath)
+{
+    // Gets file stamp
+    int iSize = FileSize(sPath);
+    int iTime = GetFileTime(sPath, FileTime_LastChange);
+    
+    // Initialize profiler
+    Profiler hProfiler = new Profiler();
+    hProfiler.Start();
+    
+    // Validate cached tree
+    if (gConfigData[iConfig].Cache != null && gConfigData[iConfig].CacheSize == iSize && gConfigData[iConfig].CacheTime == iTime && !strcmp(gConfigData[iConfig].CachePath, sPath, false))
+    {
+        // Copy cached tree
+        gConfigData[iConfig].Cache.Rewind();
+        kv.Import(gConfigData[iConfig].Cache);
+        
+        // Update statistics
+        hProfiler.Stop();
+        gConfigData[iConfig].Hits++;
+        gConfigData[iConfig].HitTime += hProfiler.Time;
+        
+        // Close profiler
+        delete hProfiler;
+        return true;
+    }
+    
+    // Parses file
+    bool bSuccess = FileToKeyValues(kv, sPath);
+    
+    // Update statistics
+    hProfiler.Stop();
+    gConfigData[iConfig].Parses++;
+    gConfigData[iConfig].ParseTime += hProfiler.Time;
+    
+    // Close profiler
+    delete hProfiler;
+    
+    // Destroy old tree
+    delete gConfigData[iConfig].Cache;
+    
+    // Validate parse
+    if (bSuccess)
+    {
+        // Store parsed tree
+        gConfigData[iConfig].Cache = new KeyValues("cache");
+        gConfigData[iConfig].Cache.Import(kv);
+        gConfigData[iConfig].CacheSize = iSize;
+        gConfigData[iConfig].CacheTime = iTime;
+        strcopy(gConfigData[iConfig].CachePath, PLATFORM_LINE_LENGTH, sPath);
+    }
+    
+    // Rewind tree
+    kv.Rewind();
+    return bSuccess;
+}
+
 /**
  * @brief Creates, deletes, sets, or gets any key/setting of any ZP config keyvalue file in memory.
  *        
@@ -1058,6 +1426,273 @@ stock bool ConfigKvGetStringBool(KeyValues kv, char[] sKey, char[] sDefaultValue
     return ConfigSettingToBool(sValue);
 }
 
+/**
+ * @brief Creates or clears the case-insensitive index of a config.
+ * 
+ * @param hIndex            The index map, or null to create.
+ * @param bMulti            (Optional) True if keys can have several indexes.
+ * @return                  The index map.
+ **/
+stock StringMap ConfigCreateIndex(StringMap hIndex, bool bMulti = false)
+{
+    // If map hasn't been created, then create
+    if (hIndex == null)
+    {
+        return new StringMap();
+    }
+    
+    // Validate multi index
+    if (bMulti)
+    {
+        // Initialize some variables
+        static char sKey[NORMAL_LINE_LENGTH]; ArrayList hList;
+        StringMapSnapshot hSnapshot = hIndex.Snapshot();
+        
+        // i = key index
+        int iSize = hSnapshot.Length;
+        for (int i = 0; i < iSize; i++)
+        {
+            // Close list of the key
+            hSnapshot.GetKey(i, sKey, sizeof(sKey));
+            hIndex.GetValue(sKey, hList);
+            delete hList;
+        }
+        
+        // Close snapshot
+        delete hSnapshot;
+    }
+    
+    // Clear out the map of all data
+    hIndex.Clear();
+    return hIndex;
+}
+
+/**
+ * @brief Adds a key into the index of a config.
+ * 
+ * @param hIndex            The index map.
+ * @param sKey              The key name. (Case insensitive)
+ * @param iD                The array index.
+ * @param bMulti            (Optional) True if keys can have several indexes.
+ **/
+stock void ConfigSetIndex(StringMap hIndex, char[] sKey, int iD, bool bMulti = false)
+{
+    // Convert key to lowercase
+    static char sLower[NORMAL_LINE_LENGTH];
+    strcopy(sLower, sizeof(sLower), sKey);
+    StringToLower(sLower);
+    
+    // Validate multi index
+    if (bMulti)
+    {
+        // Gets list of the key
+        ArrayList hList;
+        if (!hIndex.GetValue(sLower, hList))
+        {
+            hList = new ArrayList();
+            hIndex.SetValue(sLower, hList);
+        }
+        
+        // Push data into array
+        hList.Push(iD);
+    }
+    else
+    {
+        /// The first entry wins, as with the linear search
+        hIndex.SetValue(sLower, iD, false);
+    }
+}
+
+/**
+ * @brief Finds the index of a key in the index of a config.
+ * 
+ * @param hIndex            The index map.
+ * @param sKey              The key name. (Case insensitive)
+ * @param bMulti            (Optional) True to return a random one of several indexes.
+ * @return                  The array index or -1 if key wasn't found.
+ **/
+stock int ConfigGetIndex(StringMap hIndex, char[] sKey, bool bMulti = false)
+{
+    // If map hasn't been created, then stop
+    if (hIndex == null)
+    {
+        return -1;
+    }
+    
+    // Convert key to lowercase
+    static char sLower[NORMAL_LINE_LENGTH];
+    strcopy(sLower, sizeof(sLower), sKey);
+    StringToLower(sLower);
+    
+    // Validate multi index
+    if (bMulti)
+    {
+        // Gets list of the key
+        ArrayList hList;
+        if (!hIndex.GetValue(sLower, hList))
+        {
+            return -1;
+        }
+        
+        // Return random index
+        return hList.Get(GetRandomInt(0, hList.Length - 1));
+    }
+    
+    // Gets index of the key
+    int iD;
+    return hIndex.GetValue(sLower, iD) ? iD : -1;
+}
+
+/**
+ * Console command callback (zp_config_cache_stats)
+ * @brief Prints the parse time against the cache time of keyvalue configs.
+ * 
+ * @param client            The client index.
+ * @param iArguments        The number of arguments that were in the argument string.
+ **/ 
+public Action ConfigCacheOnCommandCatched(int client, int iArguments)
+{
+    // Print header
+    ReplyToCommand(client, "%-12s %8s %12s %8s %12s", "Config", "Parses", "Parse (ms)", "Hits", "Cache (ms)");
+    
+    // i = config file entry index
+    for (int i = File_Cvars; i < File_Size; i++)
+    {
+        // Validate usage
+        int iParses = gConfigData[i].Parses; int iHits = gConfigData[i].Hits;
+        if (iParses || iHits)
+        {
+            // Print average timings
+            ReplyToCommand(client, "%-12s %8d %12.3f %8d %12.3f", gConfigData[i].Alias, iParses, iParses ? gConfigData[i].ParseTime * 1000.0 / float(iParses) : 0.0, iHits, iHits ? gConfigData[i].HitTime * 1000.0 / float(iHits) : 0.0);
+        }
+    }
+    
+    return Plugin_Handled;
+}
+
+/**
+ * Console command callback (zp_config_parse_bench)
+ * @brief Measures the span parser against the old ExplodeString parser over the shipped config lines.
+ * 
+ * @param client            The client index.
+ * @param iArguments        The number of arguments that were in the argument string.
+ **/ 
+public Action ConfigParseOnCommandCatched(int client, int iArguments)
+{
+    // Initialize some variables
+    static char sPath[PLATFORM_LINE_LENGTH]; static char sLine[PLATFORM_LINE_LENGTH]; int iPasses = 10;
+    
+    // Gets amount of passes
+    if (iArguments)
+    {
+        GetCmdArg(1, sLine, sizeof(sLine));
+        iPasses = StringToInt(sLine);
+        if (iPasses < 1) iPasses = 1; else if (iPasses > 1000) iPasses = 1000;
+    }
+    
+    // Opens the directory
+    BuildPath(Path_SM, sPath, sizeof(sPath), CONFIG_PATH_DEFAULT);
+    DirectoryListing hDirectory = OpenDirectory(sPath);
+    
+    // If doesn't exist stop
+    if (hDirectory == null)
+    {
+        ReplyToCommand(client, "Benchmark: Error opening folder: \"%s\"", sPath);
+        return Plugin_Handled;
+    }
+
+    // Initialize a line list array
+    ArrayList hLines = new ArrayList(NORMAL_LINE_LENGTH);
+    
+    // Search configs in the directory
+    FileType hType; 
+    while (hDirectory.GetNext(sLine, sizeof(sLine), hType)) 
+    {
+        // Validate config format
+        int iFormat = FindCharInString(sLine, '.', true);
+        if (hType != FileType_File || iFormat == -1 || strcmp(sLine[iFormat], ".ini", false))
+        {
+            continue;
+        }
+        
+        // Opens file
+        Format(sLine, sizeof(sLine), "%s/%s", sPath, sLine);
+        File hFile = OpenFile(sLine, "r");
+        if (hFile == null)
+        {
+            continue;
+        }
+        
+        // Read lines in the file
+        while (hFile.ReadLine(sLine, sizeof(sLine)))
+        {
+            // Cut out comments at the end of a line
+            int iComment = StrContains(sLine, "//");
+            if (iComment != -1) sLine[iComment] = NULL_STRING[0];
+            
+            // Push non-empty line into array
+            TrimString(sLine);
+            if (hasLength(sLine)) hLines.PushString(sLine);
+        }
+        
+        // Close file
+        delete hFile;
+    }
+    
+    // Close directory
+    delete hDirectory;
+    
+    // Initialize profiler and the result array
+    Profiler hProfiler = new Profiler();
+    ArrayList hBuffer = new ArrayList(PLATFORM_LINE_LENGTH);
+    int iSize = hLines.Length; int iExplode; int iSpan;
+    
+    // Measure the old parser
+    hProfiler.Start();
+    for (int p = 0; p < iPasses; p++)
+    {
+        // i = line index
+        for (int i = 0; i < iSize; i++)
+        {
+            // Parses the line into array
+            hLines.GetString(i, sLine, sizeof(sLine));
+            ParamParseExplode(hBuffer, sLine, sizeof(sLine), '=');
+            iExplode += hBuffer.Length;
+            hBuffer.Clear();
+        }
+    }
+    hProfiler.Stop();
+    float flExplode = hProfiler.Time;
+    
+    // Measure the span parser
+    hProfiler.Start();
+    for (int p = 0; p < iPasses; p++)
+    {
+        // i = line index
+        for (int i = 0; i < iSize; i++)
+        {
+            // Parses the line into array
+            hLines.GetString(i, sLine, sizeof(sLine));
+            ParamParseString(hBuffer, sLine, sizeof(sLine), '=');
+            iSpan += hBuffer.Length;
+            hBuffer.Clear();
+        }
+    }
+    hProfiler.Stop();
+    float flSpan = hProfiler.Time;
+    
+    // Print timings per pass
+    ReplyToCommand(client, "Benchmark: %d lines x %d passes", iSize, iPasses);
+    ReplyToCommand(client, "%-8s %8d tokens %10.3f ms", "Explode", iExplode / iPasses, flExplode * 1000.0 / float(iPasses));
+    ReplyToCommand(client, "%-8s %8d tokens %10.3f ms", "Span", iSpan / iPasses, flSpan * 1000.0 / float(iPasses));
+    
+    // Close handles
+    delete hProfiler;
+    delete hBuffer;
+    delete hLines;
+    return Plugin_Handled;
+}
+
 /**
  * Console command callback (zp_config_menu)
  * @brief Opens the config menu.
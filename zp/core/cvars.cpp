@@ -43,6 +43,12 @@ enum
 enum struct CvarsList
 {    
     ConVar DATABASE;
+    ConVar DATABASE_FLUSH;
+    ConVar DATABASE_OUTBOX;
+    ConVar DATABASE_STATS;
+    ConVar DATABASE_TOP;
+    ConVar DATABASE_SQLITE;
+    ConVar LOAD_BUDGET;
     ConVar ANTISTICK;
     ConVar COSTUMES;
     ConVar MENU_BUTTON;
@@ -241,6 +247,7 @@ enum struct CvarsList
     ConVar MESSAGES_COUNTER;
     ConVar MESSAGES_BLAST;
     ConVar MESSAGES_DAMAGE;
+    ConVar MESSAGES_DAMAGE_TIME;
     ConVar MESSAGES_DONATE;
     ConVar MESSAGES_CLASS_INFO;
     ConVar MESSAGES_CLASS_CHOOSE;
@@ -272,6 +279,7 @@ void CvarsOnInit(/*void*/)
     CvarsOnLoad();
     
     // Forward event to modules
+    GameEngineOnCvarInit();
     DataBaseOnCvarInit();
     LogOnCvarInit();
     VEffectsOnCvarInit();
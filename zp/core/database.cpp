@@ -31,6 +31,27 @@
 #define DATABASE_SECTION     "zombiedatabase"
 #define DATABASE_MAIN        "zombieplague"
 #define DATABASE_CHILD       "zombieweapon"
+#define DATABASE_OUTBOX      "zombieoutbox"
+#define DATABASE_META        "zp_meta"
+#define DATABASE_OUTBOX_DEAD "zombieoutbox_dead"
+#define DATABASE_OUTBOX_BATCH 100
+#define DATABASE_OUTBOX_ATTEMPTS 5
+#define DATABASE_BULK_LENGTH 16384
+#define DATABASE_STATS_SAMPLES 128
+#define DATABASE_TOP_COUNT   10
+#define DATABASE_BENCH       "zombiebench"
+#define DATABASE_SQLITE_MMAP 268435456 /// 256 MB
+#define DATABASE_SQLITE_CACHE -16384   /// 16 MB
+#define DATABASE_SQLITE_PRAGMAS 5
+/**
+ * @endsection
+ **/
+ 
+/**
+ * @section Database column bits.
+ **/
+#define DATABASE_BIT(%0)     (1 << view_as<int>(%0))
+#define DATABASE_BITS        (DATABASE_BIT(ColumnType_Money) | DATABASE_BIT(ColumnType_Level) | DATABASE_BIT(ColumnType_Exp) | DATABASE_BIT(ColumnType_Zombie) | DATABASE_BIT(ColumnType_Human) | DATABASE_BIT(ColumnType_Costume) | DATABASE_BIT(ColumnType_Vision) | DATABASE_BIT(ColumnType_Time))
 /**
  * @endsection
  **/
@@ -48,6 +69,59 @@ enum /*DatabaseType*/
  * @endsection
  **/  
  
+/**
+ * @section Database outbox types.
+ **/ 
+enum /*OutboxType*/
+{
+    OutboxType_Disabled,
+    OutboxType_MySQL,
+    OutboxType_Always
+}
+/**
+ * @endsection
+ **/  
+ 
+/**
+ * @section Database statistics block.
+ **/ 
+enum /*StatsType*/
+{
+    StatsType_Count,
+    StatsType_Max,
+    StatsType_Next,
+    StatsType_Samples
+}
+/**
+ * @endsection
+ **/  
+ 
+/**
+ * @section Database pending profile.
+ **/ 
+enum struct ProfileData
+{
+    int UserID;
+    int Ticket;
+    bool Ready;
+    bool Waiting;
+    bool Found;
+    int DataID;
+    int Money;
+    int Level;
+    int Exp;
+    int ZombieClassNext;
+    int HumanClassNext;
+    int Costume;
+    bool Vision;
+    int Time;
+    int Rank;
+    ArrayList Cart;
+}
+/**
+ * @endsection
+ **/
+ 
 /**
  * @section Database column types.
  **/
@@ -79,7 +153,8 @@ enum TransactionType
     TransactionType_Load,
     TransactionType_Unload,
     TransactionType_Describe,
-    TransactionType_Info
+    TransactionType_Info,
+    TransactionType_Flush
 }
 /**
  * @endsection
@@ -101,7 +176,13 @@ enum FactoryType
     FactoryType_Select,
     FactoryType_Update,
     FactoryType_Insert,
-    FactoryType_Delete
+    FactoryType_Delete,
+    FactoryType_Replace,
+    FactoryType_Meta,
+    FactoryType_Top,
+    FactoryType_Rank,
+    FactoryType_Pragma,
+    FactoryType_Outbox
 }
 /**
  * @endsection
@@ -115,6 +196,11 @@ void DataBaseOnInit(/*void*/)
     // If database disabled, then stop
     if (!gCvarList.DATABASE.IntValue)
     {
+        // Stop storing, statistics and leaderboard timers
+        delete gServerData.FlushTimer;
+        delete gServerData.StatsTimer;
+        delete gServerData.TopTimer;
+        
         // If database already created, then close
         if (gServerData.DBI != null)
         {
@@ -133,12 +219,26 @@ void DataBaseOnInit(/*void*/)
             
             // Close connection
             delete gServerData.DBI;
+            SQLBaseOutboxClose__();
             delete gServerData.Cols;
             delete gServerData.Columns;
         }
         return;
     }
     
+    // If statistics weren't created, then create
+    if (gServerData.Stats == null)
+    {
+        // Initialize the clock and arrays of requests and timings
+        gServerData.Clock = new Profiler();
+        gServerData.Clock.Start();
+        gServerData.Queries = new ArrayList(3);
+        gServerData.Stats = new ArrayList(StatsType_Samples + DATABASE_STATS_SAMPLES);
+        gServerData.Pending = new StringMap();
+        gServerData.OutboxSaves = new ArrayList(3);
+        gServerData.OutboxLoads = new ArrayList();
+    }
+    
     // If list wasn't created, then create
     if (gServerData.Cols == null)
     {        
@@ -171,6 +271,9 @@ void DataBaseOnInit(/*void*/)
         DataBaseOnLoad();
     }
     
+    // Creates storing timer
+    DataBaseOnTimerInit();
+    
     // Hook commands
     AddCommandListener(DataBaseOnCommandListened, "exit");
     AddCommandListener(DataBaseOnCommandListened, "quit");
@@ -189,11 +292,8 @@ void DataBaseOnLoad(/*void*/)
         return;
     }
 
-    // Initialize request char
-    static char sRequest[HUGE_LINE_LENGTH]; 
-
-    // Creates a new transaction object
-    Transaction hTxn = new Transaction();
+    // Initialize a loading client array
+    ArrayList hClients = new ArrayList();
     
     // i = client index
     for (int i = 1; i <= MaxClients; i++)
@@ -211,17 +311,17 @@ void DataBaseOnLoad(/*void*/)
             gClientData[i].AccountID = GetSteamAccountID(i);
             if (gClientData[i].AccountID)
             { 
-                // Generate request
-                SQLBaseFactory__(_, sRequest, sizeof(sRequest), ColumnType_Default, FactoryType_Select, i);
-            
-                // Adds a query to the transaction
-                hTxn.AddQuery(sRequest, i);
+                // Push data into array
+                hClients.Push(GetClientUserId(i));
             }
         }
     }
     
-    // Sent a transaction 
-    gServerData.DBI.Execute(hTxn, SQLTxnSuccess_Callback, SQLTxnFailure_Callback, TransactionType_Load, DBPrio_Low); 
+    //!! Get all data at once !!//
+    DataBaseOnClientLoad(hClients, true);
+    
+    //!! Get the leaderboard !!//
+    DataBaseOnTop();
 }
 
 /**
@@ -235,9 +335,6 @@ void DataBaseOnUnload(/*void*/)
         return;
     }
 
-    // Initialize request char
-    static char sRequest[HUGE_LINE_LENGTH]; 
-
     // Creates a new transaction object
     Transaction hTxn = new Transaction();
     
@@ -249,136 +346,161 @@ void DataBaseOnUnload(/*void*/)
         {
             continue;
         }
-    
-        // Generate request
-        SQLBaseFactory__(_, sRequest, sizeof(sRequest), ColumnType_Default, FactoryType_Update, i);
         
-        // Adds a query to the transaction
-        hTxn.AddQuery(sRequest, i);
+        // Store all columns
+        gClientData[i].DataBits |= DATABASE_BITS;
+    
+        // Adds requests to the transaction
+        SQLBaseClient__(hTxn, i);
         
         // Resets variables
         gClientData[i].AccountID = 0;
         gClientData[i].Loaded = false;
         gClientData[i].DataID = -1;
+        gClientData[i].DataBits = 0;
     }
 
     // Sent a transaction 
-    gServerData.DBI.Execute(hTxn, SQLTxnSuccess_Callback, SQLTxnFailure_Callback, TransactionType_Unload, DBPrio_High); 
+    SQLBaseSend__(hTxn, TransactionType_Unload, DBPrio_High);
 }
 
 /**
- * Listener command callback (exit, quit, restart, _restart)
- * @brief Database module unloading.
- *
- * @param entity            The entity index. (Client, or 0 for server)
- * @param commandMsg        Command name, lower case. To get name as typed, use GetCmdArg() and specify argument 0.
- * @param iArguments        Argument count.
+ * @brief Database module purge function.
  **/
-public Action DataBaseOnCommandListened(int entity, char[] commandMsg, int iArguments)
+void DataBaseOnPurge(/*void*/)
 {
-    // Validate server
-    if (!entity)
-    {
-        // Switches server commands
-        switch (commandMsg[0])
-        {
-            // Exit/disabling/restart server
-            case 'e', 'q', 'r', '_' : 
-            {
-                //!! Store all current data !!//
-                DataBaseOnUnload();
-            }
-        }
-    }
-
-    // Allow commands
-    return Plugin_Continue;
+    //!! Store all changed data !!//
+    DataBaseOnFlush();
+    
+    // Move the journal into the database between maps
+    DataBaseOnCheckpoint(true);
 }
 
 /**
- * @brief Hook database cvar changes.
+ * @brief Called when a round ends. 
  **/
-void DataBaseOnCvarInit(/*void*/)
-{    
-    // Creates cvars
-    gCvarList.DATABASE = FindConVar("zp_database");  
-
-    // Hook cvars
-    HookConVarChange(gCvarList.DATABASE, DataBaseOnCvarHook);
+void DataBaseOnRoundEnd(/*void*/)
+{
+    //!! Store all changed data at once !!//
+    DataBaseOnSave();
+    
+    //!! Get the leaderboard after stored data !!//
+    DataBaseOnTop();
+    
+    // Move the journal into the database between rounds
+    DataBaseOnCheckpoint(false);
 }
 
 /**
- * Cvar hook callback (zp_database)
- * @brief Database module initialization.
- * 
- * @param hConVar           The cvar handle.
- * @param oldValue          The value before the attempted change.
- * @param newValue          The new value.
+ * @brief Stores full rows of all changed clients with one bulk request.
  **/
-public void DataBaseOnCvarHook(ConVar hConVar, char[] oldValue, char[] newValue)
+void DataBaseOnSave(/*void*/)
 {
-    // Validate new value
-    if (oldValue[0] == newValue[0])
+    // If database doesn't exist, then stop
+    if (gServerData.DBI == null)
     {
         return;
     }
     
-    // Forward event to modules
-    DataBaseOnInit();
+    // Initialize request chars
+    static char sRequest[DATABASE_BULK_LENGTH]; static char sRows[DATABASE_BULK_LENGTH]; static char sRow[HUGE_LINE_LENGTH]; sRows[0] = NULL_STRING[0];
+    
+    // Initialize rows counter
+    int iCount;
+    
+    // i = client index
+    for (int i = 1; i <= MaxClients; i++)
+    {
+        // If client wasn't inserted or changed, then skip
+        if (!gClientData[i].Loaded || !gClientData[i].AccountID || gClientData[i].DataID < 1 || !(gClientData[i].DataBits & DATABASE_BITS))
+        {
+            continue;
+        }
+        
+        // Generate row
+        SQLBaseFactory__(gServerData.MySQL, sRow, sizeof(sRow), ColumnType_Default, FactoryType_Replace, i);
+        
+        // Adds a row to the request
+        Format(sRows, sizeof(sRows), "%s%s%s", sRows, iCount++ ? ", " : "", sRow);
+        
+        // Resets changes (Cart is stored by the next flush)
+        gClientData[i].DataBits &= ~DATABASE_BITS;
+    }
+    
+    // Validate rows
+    if (!iCount)
+    {
+        return;
+    }
+    
+    // Generate request
+    SQLBaseFactory__(gServerData.MySQL, sRequest, sizeof(sRequest), ColumnType_Default, FactoryType_Replace, _, sRows);
+    
+    // Store request in the outbox, rows are logged when it is replayed
+    if (SQLBaseOutbox__(sRequest, 0, iCount))
+    {
+        // Sent stored requests
+        SQLBaseOutboxSend__();
+        return;
+    }
+
+    // Creates a new transaction object
+    Transaction hTxn = new Transaction();
+    
+    // Adds a query to the transaction
+    hTxn.AddQuery(sRequest, iCount);
+    
+    // Sent a transaction 
+    gServerData.DBI.Execute(hTxn, SQLTxnSave_Callback, SQLTxnSaveFailure_Callback, SQLBaseTrack__(FactoryType_Replace), DBPrio_Low); /// Same priority as the flush, so player writes keep their order 
 }
 
 /**
- * @brief Client has been joined.
- * 
- * @param client            The client index. 
+ * @brief Stores all changed columns of the loaded clients in one transaction.
  **/
-void DataBaseOnClientInit(int client)
+void DataBaseOnFlush(/*void*/)
 {
     // If database doesn't exist, then stop
     if (gServerData.DBI == null)
     {
         return;
     }
+
+    // Creates a new transaction object
+    Transaction hTxn = new Transaction(); int iCount;
     
-    // Verify that the client is a real player
-    if (!IsFakeClient(client))
+    // i = client index
+    for (int i = 1; i <= MaxClients; i++)
     {
-        // Initialize request char
-        static char sRequest[HUGE_LINE_LENGTH]; 
-
-        // Validate client authentication string (SteamID)
-        gClientData[client].AccountID = GetSteamAccountID(client);
-        if (gClientData[client].AccountID)
+        // If client wasn't loaded or changed, then skip
+        if (!gClientData[i].Loaded || !gClientData[i].AccountID || !gClientData[i].DataBits)
         {
-            // Generate request
-            SQLBaseFactory__(_, sRequest, sizeof(sRequest), ColumnType_Default, FactoryType_Select, client);
-
-            // Sent a request
-            gServerData.DBI.Query(SQLBaseSelect_Callback, sRequest, client, DBPrio_High);
+            continue;
         }
+    
+        // Adds requests to the transaction
+        iCount += SQLBaseClient__(hTxn, i);
+    }
+    
+    // Validate requests
+    if (!iCount)
+    {
+        delete hTxn;
+        
+        // Sent stored requests
+        DataBaseOnReplay();
+        return;
     }
-}
 
-/**
- * @brief Called when a client is disconnected from the server.
- *
- * @param client            The client index.
- **/
-void DataBaseOnClientDisconnectPost(int client)
-{
-    // Update data in the database
-    DataBaseOnClientUpdate(client, ColumnType_Default);
+    // Sent a transaction 
+    SQLBaseSend__(hTxn, TransactionType_Flush, DBPrio_Low);
 }
 
 /**
- * @brief Client has been changed class state.
+ * @brief Refreshes the cached leaderboard in one transaction.
  *
- * @param client            The client index.
- * @param nColumn           The column type.
- * @param mFactory          (Optional) The request type.
- * @param sData             (Optional) The string input.
+ * @note  Rankings are served from the cache, so the ordering requests never run on demand.
  **/
-void DataBaseOnClientUpdate(int client, ColumnType nColumn, FactoryType mFactory = FactoryType_Update, char[] sData = "")
+void DataBaseOnTop(/*void*/)
 {
     // If database doesn't exist, then stop
     if (gServerData.DBI == null)
@@ -386,201 +508,2530 @@ void DataBaseOnClientUpdate(int client, ColumnType nColumn, FactoryType mFactory
         return;
     }
     
-    // If client wasn't loaded, then stop
-    if (!gClientData[client].Loaded || !gClientData[client].AccountID)
-    {
-        return;
-    }
+    // Creates a new transaction object
+    Transaction hTxn = new Transaction();
 
     // Initialize request char
     static char sRequest[HUGE_LINE_LENGTH]; 
-
-    // Generate request
-    SQLBaseFactory__(_, sRequest, sizeof(sRequest), nColumn, mFactory, client, sData);
-
-    // Sent a request
-    gServerData.DBI.Query(SQLBaseUpdate_Callback, sRequest, client, DBPrio_Low);
+    
+    // Execute requests
+    static const ColumnType nColumn[4] = { ColumnType_Level, ColumnType_Exp, ColumnType_Money, ColumnType_Default };
+    for (int x = 0; x < sizeof(nColumn); x++)
+    {
+        // Generate request
+        SQLBaseFactory__(_, sRequest, sizeof(sRequest), nColumn[x], FactoryType_Top);
+    
+        // Adds a query to the transaction
+        hTxn.AddQuery(sRequest, nColumn[x]);
+    }
+    
+    // Sent a transaction 
+    gServerData.DBI.Execute(hTxn, SQLTxnTop_Callback, SQLTxnFailure_Callback, SQLBaseTrack__(FactoryType_Top, TransactionType_Load), DBPrio_Low); 
 }
 
-/*
- * Callbacks SQL transactions.
- */
- 
 /**
- * @brief Callback for a successful transaction.
- * 
- * @param hDatabase         Handle to the database connection.
- * @param mTransaction      Data passed in via the original threaded invocation.
- * @param numQueries        Number of queries executed in the transaction.
- * @param hResults          An array of DBResultSet results, one for each of numQueries. They are closed automatically.
- * @param client            An array of each data value passed.
+ * @brief Sets the SQLite pragmas of the database and the outbox.
  **/
-public void SQLTxnSuccess_Callback(Database hDatabase, TransactionType mTransaction, int numQueries, DBResultSet[] hResults, int[] client)
+void DataBaseOnPragma(/*void*/)
 {
-    // Gets transaction type
-    switch (mTransaction)
+    // Initialize request char
+    static char sRequest[NORMAL_LINE_LENGTH]; 
+    
+    // Gets profile mode
+    bool bProfile = gCvarList.DATABASE_SQLITE.BoolValue;
+    
+    // x = step index
+    for (int x = 0; x < DATABASE_SQLITE_PRAGMAS; x++)
     {
-        /*
-            case TransactionType_Create :
-            case TransactionType_Unload :
-        */
+        // Generate request
+        SQLBasePragma__(sRequest, sizeof(sRequest), x, bProfile);
         
-        case TransactionType_Load :
+        /// Journal mode can't be changed inside a transaction, so requests are sent one by one
+        if (gServerData.DBI != null && !gServerData.MySQL)
         {
-            // i = request index
-            for (int i = 0; i < numQueries; i++)
-            {
-                SQLBaseSelect_Callback(hDatabase, hResults[i], "", client[i]);
-            }
+            gServerData.DBI.Query(SQLBaseUpdate_Callback, sRequest, SQLBaseTrack__(FactoryType_Pragma), DBPrio_High);
         }
-
-        case TransactionType_Describe, TransactionType_Info :
+        
+        // Validate outbox
+        if (gServerData.Outbox != null)
         {
-            // Validate request
-            if (numQueries <= view_as<int>(TransactionType_Info)) /// If drop include, then stop
-            {
-                SQLBaseAdd_Callback(hDatabase, hResults[1], (mTransaction == TransactionType_Describe));
-            }
+            gServerData.Outbox.Query(SQLBaseUpdate_Callback, sRequest, SQLBaseTrack__(FactoryType_Outbox), DBPrio_High);
         }
     }
 }
 
 /**
- * @brief Callback for a failed transaction.
- * 
- * @param hDatabase         Handle to the database connection.
- * @param mTransaction      Data passed in via the original threaded invocation.
- * @param numQueries        Number of queries executed in the transaction.
- * @param sError            Error string if there was an error.
- * @param iFail             Index of the query that failed, or -1 if something else.
- * @param client            An array of each data value passed.
+ * @brief Moves the write-ahead log of the SQLite database into the main file.
+ *
+ * @param bTruncate         True to truncate the log, false for a passive checkpoint.
  **/
-public void SQLTxnFailure_Callback(Database hDatabase, TransactionType mTransaction, int numQueries, char[] sError, int iFail, int[] client)
+void DataBaseOnCheckpoint(bool bTruncate)
 {
-    // If invalid query handle, then log error
-    if (hDatabase == null || hasLength(sError))
+    // If profile is disabled, then stop
+    if (!gCvarList.DATABASE_SQLITE.BoolValue)
     {
-        // Unexpected error, log it
-        LogEvent(false, LogType_Error, LOG_CORE_EVENTS, LogModule_Database, "Query", "ID: \"%d\" - \"%s\"", iFail, sError);
+        return;
+    }
+    
+    // Initialize request char
+    static char sRequest[NORMAL_LINE_LENGTH]; 
+    FormatEx(sRequest, sizeof(sRequest), "PRAGMA wal_checkpoint(%s);", bTruncate ? "TRUNCATE" : "PASSIVE");
+    
+    // Validate SQLite connection
+    if (gServerData.DBI != null && !gServerData.MySQL)
+    {
+        gServerData.DBI.Query(SQLBaseUpdate_Callback, sRequest, SQLBaseTrack__(FactoryType_Pragma), DBPrio_Low);
+    }
+    
+    // Validate outbox
+    if (gServerData.Outbox != null && bTruncate)
+    {
+        gServerData.Outbox.Query(SQLBaseUpdate_Callback, sRequest, SQLBaseTrack__(FactoryType_Outbox), DBPrio_Low);
     }
 }
 
-/*
- * Callbacks SQL functions.
- */
-
 /**
- * SQL: DROP, CREATE
- * @brief Callback for receiving asynchronous database connection.
- *
- * @param hDatabase         Handle to the database connection.
- * @param sError            Error string if there was an error.
- * @param bDropping         Data passed in via the original threaded invocation.
+ * @brief Opens the local outbox storage.
  **/
-public void SQLBaseConnect_Callback(Database hDatabase, char[] sError, bool bDropping)
+void DataBaseOnOutboxInit(/*void*/)
 {
-    // If invalid query handle, then log error
-    if (hDatabase == null || hasLength(sError))
+    // Close outbox
+    SQLBaseOutboxClose__();
+    
+    // Validate outbox mode
+    switch (gCvarList.DATABASE_OUTBOX.IntValue)
     {
-        // Unexpected error, log it
-        LogEvent(false, LogType_Error, LOG_CORE_EVENTS, LogModule_Database, "Query", "%s", sError);
+        case OutboxType_Disabled : return;
+        case OutboxType_MySQL : if (!gServerData.MySQL) return;
     }
-    else
+
+    // Opens a local SQLite database
+    static char sError[PLATFORM_LINE_LENGTH];
+    gServerData.Outbox = SQLite_UseDatabase(DATABASE_OUTBOX, sError, sizeof(sError));
+    
+    // If invalid database handle, then log error
+    if (gServerData.Outbox == null)
     {
-        // Validate a global database handler
-        if (gServerData.DBI != null)
-        {
-            // Validate a new database is the same connection as old database
+        // Unexpected error, log it
+        LogEvent(false, LogType_Error, LOG_CORE_EVENTS, LogModule_Database, "Query", "Outbox: \"%s\"", sError);
+        return;
+    }
+    
+    // Initialize request char
+    static char sRequest[HUGE_LINE_LENGTH]; 
+    
+    // Creates the outbox table, account is 0 for requests of several clients
+    FormatEx(sRequest, sizeof(sRequest), "CREATE TABLE IF NOT EXISTS `%s` (`id` INTEGER PRIMARY KEY AUTOINCREMENT NOT NULL, `query` TEXT NOT NULL, `account` INTEGER NOT NULL DEFAULT 0);", DATABASE_OUTBOX);
+    if (!SQL_FastQuery(gServerData.Outbox, sRequest))
+    {
+        // Unexpected error, log it
+        SQL_GetError(gServerData.Outbox, sError, sizeof(sError));
+        LogEvent(false, LogType_Error, LOG_CORE_EVENTS, LogModule_Database, "Query", "Outbox: \"%s\"", sError);
+        
+        // Close outbox
+        delete gServerData.Outbox;
+        return;
+    }
+    
+    // Adds the account column to outboxes of the older versions
+    FormatEx(sRequest, sizeof(sRequest), "SELECT `account` FROM `%s` LIMIT 0;", DATABASE_OUTBOX);
+    if (!SQL_FastQuery(gServerData.Outbox, sRequest))
+    {
+        FormatEx(sRequest, sizeof(sRequest), "ALTER TABLE `%s` ADD COLUMN `account` INTEGER NOT NULL DEFAULT 0;", DATABASE_OUTBOX);
+        SQL_FastQuery(gServerData.Outbox, sRequest);
+    }
+    
+    // Creates the index for checks before loading
+    FormatEx(sRequest, sizeof(sRequest), "CREATE INDEX IF NOT EXISTS `%s_account` ON `%s` (`account`);", DATABASE_OUTBOX, DATABASE_OUTBOX);
+    SQL_FastQuery(gServerData.Outbox, sRequest);
+    
+    // Creates the table for requests, which were failed too many times
+    FormatEx(sRequest, sizeof(sRequest), "CREATE TABLE IF NOT EXISTS `%s` (`id` INTEGER PRIMARY KEY NOT NULL, `query` TEXT NOT NULL, `error` TEXT NOT NULL);", DATABASE_OUTBOX_DEAD);
+    if (!SQL_FastQuery(gServerData.Outbox, sRequest))
+    {
+        // Unexpected error, log it
+        SQL_GetError(gServerData.Outbox, sError, sizeof(sError));
+        LogEvent(false, LogType_Error, LOG_CORE_EVENTS, LogModule_Database, "Query", "Outbox: \"%s\"", sError);
+    }
+    
+    // Resets failures
+    gServerData.OutboxFailID = 0;
+    gServerData.OutboxFailCount = 0;
+    
+    // x = step index
+    for (int x = 0; x < DATABASE_SQLITE_PRAGMAS; x++)
+    {
+        // Sets pragmas of the outbox
+        SQLBasePragma__(sRequest, sizeof(sRequest), x, gCvarList.DATABASE_SQLITE.BoolValue);
+        gServerData.Outbox.Query(SQLBaseUpdate_Callback, sRequest, SQLBaseTrack__(FactoryType_Outbox), DBPrio_High);
+    }
+    
+    // Sent requests left from the last session
+    DataBaseOnReplay();
+}
+
+/**
+ * @brief Requests the oldest stored outbox requests, which are sent in one transaction.
+ *
+ * @note  Only one batch is in flight at once, so the database thread queue stays short.
+ *        Outbox requests are sent at the priority of the player writes, so they are read after the queued inserts.
+ **/
+void DataBaseOnReplay(/*void*/)
+{
+    // If database or outbox doesn't exist or busy, then stop
+    if (gServerData.DBI == null || gServerData.Outbox == null || gServerData.OutboxBusy)
+    {
+        return;
+    }
+    
+    // Initialize request char
+    static char sRequest[BIG_LINE_LENGTH]; 
+    
+    // Gets the oldest requests
+    FormatEx(sRequest, sizeof(sRequest), "SELECT `id`, `query` FROM `%s` ORDER BY `id` LIMIT %d;", DATABASE_OUTBOX, DATABASE_OUTBOX_BATCH);
+    
+    // Sent a request 
+    gServerData.OutboxBusy = true;
+    gServerData.Outbox.Query(SQLBaseReplay_Callback, sRequest, SQLBaseTrack__(FactoryType_Outbox), DBPrio_Low);
+}
+
+/**
+ * @brief Creates the storing timer.
+ **/
+void DataBaseOnTimerInit(/*void*/)
+{
+    // Stop storing, statistics and leaderboard timers
+    delete gServerData.FlushTimer;
+    delete gServerData.StatsTimer;
+    delete gServerData.TopTimer;
+    
+    // If database disabled, then stop
+    if (!gCvarList.DATABASE.IntValue)
+    {
+        return;
+    }
+    
+    // Validate interval
+    float flInterval = gCvarList.DATABASE_FLUSH.FloatValue;
+    if (flInterval > 0.0)
+    {
+        // Creates storing timer
+        gServerData.FlushTimer = CreateTimer(flInterval, DataBaseOnFlushTimer, _, TIMER_REPEAT);
+    }
+    
+    // Validate interval
+    flInterval = gCvarList.DATABASE_STATS.FloatValue;
+    if (flInterval > 0.0)
+    {
+        // Creates statistics timer
+        gServerData.StatsTimer = CreateTimer(flInterval, DataBaseOnStatsTimer, _, TIMER_REPEAT);
+    }
+    
+    // Validate interval
+    flInterval = gCvarList.DATABASE_TOP.FloatValue;
+    if (flInterval > 0.0)
+    {
+        // Creates leaderboard timer
+        gServerData.TopTimer = CreateTimer(flInterval, DataBaseOnTopTimer, _, TIMER_REPEAT);
+    }
+}
+
+/**
+ * @brief Timer callback, stores all changed data.
+ *
+ * @param hTimer            The timer handle.
+ **/
+public Action DataBaseOnFlushTimer(Handle hTimer)
+{
+    //!! Store all changed data !!//
+    DataBaseOnFlush();
+    
+    // Allow timer
+    return Plugin_Continue;
+}
+
+/**
+ * @brief Timer callback, refreshes the leaderboard.
+ *
+ * @param hTimer            The timer handle.
+ **/
+public Action DataBaseOnTopTimer(Handle hTimer)
+{
+    //!! Get the leaderboard !!//
+    DataBaseOnTop();
+    
+    // Allow timer
+    return Plugin_Continue;
+}
+
+/**
+ * @brief Timer callback, logs the request statistics.
+ *
+ * @param hTimer            The timer handle.
+ **/
+public Action DataBaseOnStatsTimer(Handle hTimer)
+{
+    // Initialize some variables
+    static char sBuffer[CONSOLE_LINE_LENGTH]; static char sName[SMALL_LINE_LENGTH]; float flP50; float flP95; float flMax;
+    
+    // Format in flight requests
+    FormatEx(sBuffer, sizeof(sBuffer), "In flight: \"%d\"", gServerData.InFlight);
+    
+    // i = factory index
+    int iSize = gServerData.Stats.Length;
+    for (int i = 0; i < iSize; i++)
+    {
+        // Validate requests
+        int iCount = SQLBaseStats__(view_as<FactoryType>(i), flP50, flP95, flMax);
+        if (iCount)
+        {
+            // Format timings
+            SQLBaseFactoryName__(view_as<FactoryType>(i), sName, sizeof(sName));
+            Format(sBuffer, sizeof(sBuffer), "%s | %s: %d/%.1f/%.1f/%.1f ms", sBuffer, sName, iCount, flP50, flP95, flMax);
+        }
+    }
+    
+    // Log database statistics
+    LogEvent(true, LogType_Normal, LOG_CORE_EVENTS, LogModule_Database, "Stats", "%s", sBuffer);
+    
+    // Allow timer
+    return Plugin_Continue;
+}
+
+/**
+ * @brief Creates commands for database module.
+ **/
+void DataBaseOnCommandInit(/*void*/)
+{
+    // Hook commands
+    RegAdminCmd("zp_db_stats", DataBaseOnCommandCatched, ADMFLAG_CONFIG, "Prints the database request timings. Usage: zp_db_stats");
+    RegAdminCmd("zp_db_bench", DataBaseBenchOnCommandCatched, ADMFLAG_CONFIG, "Measures SQLite inserts and updates per second with the default and the performance pragmas. Blocks the server while running. Usage: zp_db_bench [rows]");
+    RegConsoleCmd("ztop", DataBaseTopOnCommandCatched, "Opens the leaderboard menu.");
+    RegConsoleCmd("zrank", DataBaseRankOnCommandCatched, "Prints the rank of the player.");
+}
+
+/**
+ * Console command callback (zp_db_bench)
+ * @brief Measures SQLite inserts and updates per second.
+ * 
+ * @param client            The client index.
+ * @param iArguments        The number of arguments that were in the argument string.
+ **/ 
+public Action DataBaseBenchOnCommandCatched(int client, int iArguments)
+{
+    // Initialize some variables
+    static char sBuffer[PLATFORM_LINE_LENGTH]; int iRows = 500;
+    
+    // Gets amount of rows
+    if (iArguments)
+    {
+        GetCmdArg(1, sBuffer, sizeof(sBuffer));
+        iRows = StringToInt(sBuffer);
+        if (iRows < 10) iRows = 10; else if (iRows > 10000) iRows = 10000;
+    }
+    
+    // Opens a local SQLite database
+    Database hBench = SQLite_UseDatabase(DATABASE_BENCH, sBuffer, sizeof(sBuffer));
+    if (hBench == null)
+    {
+        ReplyToCommand(client, "Benchmark: \"%s\"", sBuffer);
+        return Plugin_Handled;
+    }
+    
+    // x = profile index
+    float flInsert; float flUpdate;
+    for (int x = 0; x < 2; x++)
+    {
+        // Measure requests
+        if (!SQLBaseBenchmark__(hBench, view_as<bool>(x), iRows, flInsert, flUpdate))
+        {
+            SQL_GetError(hBench, sBuffer, sizeof(sBuffer));
+            ReplyToCommand(client, "Benchmark: \"%s\"", sBuffer);
+            break;
+        }
+        
+        // Print rates
+        ReplyToCommand(client, "%-8s rows: %d inserts: %.0f/s updates: %.0f/s", x ? "Profile" : "Default", iRows, flInsert, flUpdate);
+    }
+    
+    // Close database
+    delete hBench;
+    return Plugin_Handled;
+}
+
+/**
+ * Console command callback (ztop)
+ * @brief Opens the leaderboard menu.
+ * 
+ * @param client            The client index.
+ * @param iArguments        The number of arguments that were in the argument string.
+ **/ 
+public Action DataBaseTopOnCommandCatched(int client, int iArguments)
+{
+    DataBaseMenu(client);
+    return Plugin_Handled;
+}
+
+/**
+ * Console command callback (zrank)
+ * @brief Prints the rank of the player.
+ * 
+ * @param client            The client index.
+ * @param iArguments        The number of arguments that were in the argument string.
+ **/ 
+public Action DataBaseRankOnCommandCatched(int client, int iArguments)
+{
+    // Validate client
+    if (!IsPlayerExist(client, false))
+    {
+        return Plugin_Handled;
+    }
+    
+    // Validate rank
+    if (gClientData[client].Rank)
+    {
+        TranslationPrintToChat(client, "rank info", gClientData[client].Rank, (gServerData.TopTotal > gClientData[client].Rank) ? gServerData.TopTotal : gClientData[client].Rank);
+    }
+    else
+    {
+        TranslationPrintToChat(client, "rank empty");
+    }
+    return Plugin_Handled;
+}
+
+/**
+ * Console command callback (zp_db_stats)
+ * @brief Prints the database request timings.
+ * 
+ * @param client            The client index.
+ * @param iArguments        The number of arguments that were in the argument string.
+ **/ 
+public Action DataBaseOnCommandCatched(int client, int iArguments)
+{
+    // If statistics doesn't exist, then stop
+    if (gServerData.Stats == null)
+    {
+        return Plugin_Handled;
+    }
+    
+    // Initialize some variables
+    static char sName[SMALL_LINE_LENGTH]; float flP50; float flP95; float flMax;
+
+    // Print header
+    ReplyToCommand(client, "%-10s %8s %10s %10s %10s", "Request", "Count", "p50 (ms)", "p95 (ms)", "Max (ms)");
+    
+    // i = factory index
+    int iSize = gServerData.Stats.Length;
+    for (int i = 0; i < iSize; i++)
+    {
+        // Validate requests
+        int iCount = SQLBaseStats__(view_as<FactoryType>(i), flP50, flP95, flMax);
+        if (iCount)
+        {
+            // Print timings
+            SQLBaseFactoryName__(view_as<FactoryType>(i), sName, sizeof(sName));
+            ReplyToCommand(client, "%-10s %8d %10.2f %10.2f %10.2f", sName, iCount, flP50, flP95, flMax);
+        }
+    }
+    
+    // Print in flight requests
+    ReplyToCommand(client, "In flight: %d", gServerData.InFlight);
+    return Plugin_Handled;
+}
+
+/**
+ * Listener command callback (exit, quit, restart, _restart)
+ * @brief Database module unloading.
+ *
+ * @param entity            The entity index. (Client, or 0 for server)
+ * @param commandMsg        Command name, lower case. To get name as typed, use GetCmdArg() and specify argument 0.
+ * @param iArguments        Argument count.
+ **/
+public Action DataBaseOnCommandListened(int entity, char[] commandMsg, int iArguments)
+{
+    // Validate server
+    if (!entity)
+    {
+        // Switches server commands
+        switch (commandMsg[0])
+        {
+            // Exit/disabling/restart server
+            case 'e', 'q', 'r', '_' : 
+            {
+                //!! Store all current data !!//
+                DataBaseOnUnload();
+            }
+        }
+    }
+
+    // Allow commands
+    return Plugin_Continue;
+}
+
+/**
+ * @brief Hook database cvar changes.
+ **/
+void DataBaseOnCvarInit(/*void*/)
+{    
+    // Creates cvars
+    gCvarList.DATABASE        = FindConVar("zp_database");  
+    gCvarList.DATABASE_FLUSH  = FindConVar("zp_database_flush");  
+    gCvarList.DATABASE_OUTBOX = FindConVar("zp_database_outbox");  
+    gCvarList.DATABASE_STATS  = FindConVar("zp_database_stats");  
+    gCvarList.DATABASE_TOP    = FindConVar("zp_database_top");  
+    gCvarList.DATABASE_SQLITE = FindConVar("zp_database_sqlite");  
+
+    // Hook cvars
+    HookConVarChange(gCvarList.DATABASE,        DataBaseOnCvarHook);
+    HookConVarChange(gCvarList.DATABASE_FLUSH,  DataBaseOnCvarHookFlush);
+    HookConVarChange(gCvarList.DATABASE_OUTBOX, DataBaseOnCvarHookOutbox);
+    HookConVarChange(gCvarList.DATABASE_STATS,  DataBaseOnCvarHookFlush);
+    HookConVarChange(gCvarList.DATABASE_TOP,    DataBaseOnCvarHookFlush);
+    HookConVarChange(gCvarList.DATABASE_SQLITE, DataBaseOnCvarHookPragma);
+}
+
+/**
+ * Cvar hook callback (zp_database)
+ * @brief Database module initialization.
+ * 
+ * @param hConVar           The cvar handle.
+ * @param oldValue          The value before the attempted change.
+ * @param newValue          The new value.
+ **/
+public void DataBaseOnCvarHook(ConVar hConVar, char[] oldValue, char[] newValue)
+{
+    // Validate new value
+    if (oldValue[0] == newValue[0])
+    {
+        return;
+    }
+    
+    // Forward event to modules
+    DataBaseOnInit();
+}
+
+/**
+ * Cvar hook callback (zp_database_flush, zp_database_stats, zp_database_top)
+ * @brief Database timers initialization.
+ * 
+ * @param hConVar           The cvar handle.
+ * @param oldValue          The value before the attempted change.
+ * @param newValue          The new value.
+ **/
+public void DataBaseOnCvarHookFlush(ConVar hConVar, char[] oldValue, char[] newValue)
+{
+    // Validate new value
+    if (!strcmp(oldValue, newValue, false))
+    {
+        return;
+    }
+    
+    // Forward event to modules
+    DataBaseOnTimerInit();
+}
+
+/**
+ * Cvar hook callback (zp_database_outbox)
+ * @brief Database outbox initialization.
+ * 
+ * @param hConVar           The cvar handle.
+ * @param oldValue          The value before the attempted change.
+ * @param newValue          The new value.
+ **/
+public void DataBaseOnCvarHookOutbox(ConVar hConVar, char[] oldValue, char[] newValue)
+{
+    // Validate new value
+    if (oldValue[0] == newValue[0])
+    {
+        return;
+    }
+    
+    // If database doesn't exist, then stop
+    if (gServerData.DBI == null)
+    {
+        return;
+    }
+    
+    // Forward event to modules
+    DataBaseOnOutboxInit();
+}
+
+/**
+ * Cvar hook callback (zp_database_sqlite)
+ * @brief Database pragmas initialization.
+ * 
+ * @param hConVar           The cvar handle.
+ * @param oldValue          The value before the attempted change.
+ * @param newValue          The new value.
+ **/
+public void DataBaseOnCvarHookPragma(ConVar hConVar, char[] oldValue, char[] newValue)
+{
+    // Validate new value
+    if (oldValue[0] == newValue[0])
+    {
+        return;
+    }
+    
+    // Forward event to modules
+    DataBaseOnPragma();
+}
+
+/**
+ * @brief Client has been authorized.
+ * 
+ * @note  The profile is requested here, so the loading is hidden behind the rest of the connection.
+ *
+ * @param client            The client index. 
+ **/
+void DataBaseOnClientAuthorized(int client)
+{
+    // If database doesn't exist, then stop
+    if (gServerData.DBI == null)
+    {
+        return;
+    }
+    
+    // Verify that the client is a real player
+    if (!IsFakeClient(client) && !gClientData[client].Loaded)
+    {
+        // Validate client authentication string (SteamID)
+        gClientData[client].AccountID = GetSteamAccountID(client);
+        if (gClientData[client].AccountID)
+        {
+            // Initialize a loading client array
+            ArrayList hClients = new ArrayList();
+            
+            // Push data into array
+            hClients.Push(GetClientUserId(client));
+            
+            //!! Get all data before joining !!//
+            DataBaseOnClientLoad(hClients, false);
+        }
+    }
+}
+
+/**
+ * @brief Client has been joined.
+ * 
+ * @param client            The client index. 
+ **/
+void DataBaseOnClientInit(int client)
+{
+    // If database doesn't exist, then stop
+    if (gServerData.DBI == null)
+    {
+        return;
+    }
+    
+    // Verify that the client is a real player
+    if (!IsFakeClient(client) && !gClientData[client].Loaded)
+    {
+        // Validate client authentication string (SteamID)
+        gClientData[client].AccountID = GetSteamAccountID(client);
+        if (gClientData[client].AccountID)
+        {
+            // Validate prefetched profile
+            static char sKey[SMALL_LINE_LENGTH]; ProfileData mProfile;
+            IntToString(gClientData[client].AccountID, sKey, sizeof(sKey));
+            if (gServerData.Pending.GetArray(sKey, mProfile, sizeof(mProfile)) && mProfile.UserID == GetClientUserId(client))
+            {
+                // Sets client data, or wait for the loading
+                if (!SQLBaseApply__(client))
+                {
+                    mProfile.Waiting = true;
+                    gServerData.Pending.SetArray(sKey, mProfile, sizeof(mProfile));
+                }
+                return;
+            }
+            
+            // Initialize a loading client array
+            ArrayList hClients = new ArrayList();
+            
+            // Push data into array
+            hClients.Push(GetClientUserId(client));
+            
+            //!! Get all data !!//
+            DataBaseOnClientLoad(hClients, true);
+        }
+    }
+}
+
+/**
+ * @brief Loads the main row, the weapon cart and the rank of clients in one transaction.
+ *
+ * @note  If the outbox has writes of these accounts, the loading waits until they are replayed.
+ * 
+ * @param hClients          The array with user ids. (Closed after loading)
+ * @param bWaiting          True to apply profiles on arrival, false to keep them pending until the client joins.
+ **/
+void DataBaseOnClientLoad(ArrayList hClients, bool bWaiting)
+{
+    // Validate clients
+    int iSize = hClients.Length;
+    if (!iSize)
+    {
+        delete hClients;
+        return;
+    }
+    
+    // Initialize some variables
+    static char sKey[SMALL_LINE_LENGTH]; ProfileData mProfile; ProfileData mEmpty;
+    
+    // Gets ticket of the request
+    int iTicket = SQLBaseTrack__(FactoryType_Select, hClients);
+
+    // i = array index
+    for (int i = 0; i < iSize; i++)
+    {
+        // Gets client index from the user id
+        int iUserID = hClients.Get(i);
+        int client = GetClientOfUserId(iUserID);
+        if (client)
+        {
+            // Gets previous request
+            IntToString(gClientData[client].AccountID, sKey, sizeof(sKey));
+            if (gServerData.Pending.GetArray(sKey, mProfile, sizeof(mProfile)))
+            {
+                delete mProfile.Cart;
+                mProfile.Waiting = (mProfile.UserID == iUserID) && mProfile.Waiting;
+            }
+            else
+            {
+                mProfile = mEmpty;
+            }
+            
+            /// Only the latest request fills the profile
+            mProfile.UserID  = iUserID;
+            mProfile.Ticket  = iTicket;
+            mProfile.Ready   = false;
+            mProfile.Found   = false;
+            mProfile.Waiting = mProfile.Waiting || bWaiting;
+            mProfile.Rank    = 0;
+            gServerData.Pending.SetArray(sKey, mProfile, sizeof(mProfile));
+        }
+    }
+    
+    // Validate outbox
+    if (gServerData.Outbox != null)
+    {
+        /// Writes of these accounts can still wait in the outbox, so they are loaded after the replay
+        SQLBaseOutboxCheck__(iTicket);
+        return;
+    }
+    
+    // Sent a transaction 
+    SQLBaseLoad__(iTicket);
+}
+
+/**
+ * @brief Called when a client is disconnected from the server.
+ *
+ * @param client            The client index.
+ **/
+void DataBaseOnClientDisconnectPost(int client)
+{
+    // Remove pending profile
+    SQLBaseDiscard__(client);
+    
+    // If database doesn't exist, then stop
+    if (gServerData.DBI == null)
+    {
+        return;
+    }
+    
+    // If client wasn't loaded, then stop
+    if (!gClientData[client].Loaded || !gClientData[client].AccountID)
+    {
+        return;
+    }
+    
+    // Store all columns
+    gClientData[client].DataBits |= DATABASE_BITS;
+
+    // Creates a new transaction object
+    Transaction hTxn = new Transaction();
+    
+    // Adds requests to the transaction
+    SQLBaseClient__(hTxn, client);
+    
+    // Sent a transaction 
+    SQLBaseSend__(hTxn, TransactionType_Flush, DBPrio_Low);
+}
+
+/**
+ * @brief Client has been changed class state.
+ *
+ * @note  Updates of the main table and the cart are only marked here and stored by the next flush.
+ *
+ * @param client            The client index.
+ * @param nColumn           The column type.
+ **/
+void DataBaseOnClientUpdate(int client, ColumnType nColumn)
+{
+    // If database doesn't exist, then stop
+    if (gServerData.DBI == null)
+    {
+        return;
+    }
+    
+    // If client wasn't loaded, then stop
+    if (!gClientData[client].Loaded || !gClientData[client].AccountID)
+    {
+        return;
+    }
+    
+    // Mark column as changed
+    gClientData[client].DataBits |= (nColumn == ColumnType_Default) ? DATABASE_BITS : DATABASE_BIT(nColumn);
+}
+
+/*
+ * Callbacks SQL transactions.
+ */
+ 
+/**
+ * @brief Callback for a successful transaction.
+ * 
+ * @param hDatabase         Handle to the database connection.
+ * @param iTicket           The request ticket.
+ * @param numQueries        Number of queries executed in the transaction.
+ * @param hResults          An array of DBResultSet results, one for each of numQueries. They are closed automatically.
+ * @param client            An array of each data value passed.
+ **/
+public void SQLTxnSuccess_Callback(Database hDatabase, int iTicket, int numQueries, DBResultSet[] hResults, int[] client)
+{
+    // Gets transaction type
+    TransactionType mTransaction = SQLBaseUntrack__(iTicket);
+    switch (mTransaction)
+    {
+        /*
+            case TransactionType_Create :
+            case TransactionType_Load :
+            case TransactionType_Unload :
+        */
+
+        case TransactionType_Describe, TransactionType_Info :
+        {
+            // Validate request
+            if (numQueries <= view_as<int>(TransactionType_Info)) /// If drop include, then stop
+            {
+                SQLBaseAdd_Callback(hDatabase, hResults[1], (mTransaction == TransactionType_Describe));
+            }
+        }
+    }
+}
+
+/**
+ * @brief Callback for a failed transaction.
+ * 
+ * @param hDatabase         Handle to the database connection.
+ * @param iTicket           The request ticket.
+ * @param numQueries        Number of queries executed in the transaction.
+ * @param sError            Error string if there was an error.
+ * @param iFail             Index of the query that failed, or -1 if something else.
+ * @param client            An array of each data value passed.
+ **/
+public void SQLTxnFailure_Callback(Database hDatabase, int iTicket, int numQueries, char[] sError, int iFail, int[] client)
+{
+    // Release the ticket
+    SQLBaseUntrack__(iTicket);
+    
+    // If invalid query handle, then log error
+    if (hDatabase == null || hasLength(sError))
+    {
+        // Unexpected error, log it
+        LogEvent(false, LogType_Error, LOG_CORE_EVENTS, LogModule_Database, "Query", "ID: \"%d\" - \"%s\"", iFail, sError);
+    }
+}
+
+/**
+ * @brief Callback for a successful schema fingerprint transaction.
+ * 
+ * @param hDatabase         Handle to the database connection.
+ * @param iTicket           The request ticket.
+ * @param numQueries        Number of queries executed in the transaction.
+ * @param hResults          An array of DBResultSet results, one for each of numQueries. They are closed automatically.
+ * @param iData             An array of each data value passed.
+ **/
+public void SQLTxnMeta_Callback(Database hDatabase, int iTicket, int numQueries, DBResultSet[] hResults, any[] iData)
+{
+    // Gets type of connection
+    bool MySQL = SQLBaseUntrack__(iTicket);
+    
+    // Initialize fingerprint chars
+    static char sHash[SMALL_LINE_LENGTH]; static char sStored[SMALL_LINE_LENGTH]; sStored[0] = NULL_STRING[0];
+    
+    // Gets fingerprint of the current schema
+    SQLBaseFingerprint__(MySQL, sHash, sizeof(sHash));
+    
+    // Gets stored fingerprint
+    if (hResults[1].FetchRow())
+    {
+        hResults[1].FetchString(0, sStored, sizeof(sStored));
+    }
+    
+    // Validate the same schema
+    if (!strcmp(sHash, sStored, false))
+    {
+        // Creates a new transaction object
+        Transaction hTxn = new Transaction();
+        
+        // Initialize request char
+        static char sRequest[SMALL_LINE_LENGTH]; 
+        
+        /// Keys are a per-connection setting, so they are always sent
+        SQLBaseFactory__(MySQL, sRequest, sizeof(sRequest), ColumnType_Default, FactoryType_Keys);
+        
+        // Adds a query to the transaction
+        hTxn.AddQuery(sRequest);
+        
+        // Sent a transaction 
+        hDatabase.Execute(hTxn, SQLTxnSuccess_Callback, SQLTxnFailure_Callback, SQLBaseTrack__(FactoryType_Keys, TransactionType_Create), DBPrio_High); 
+        
+        // Log fingerprint info
+        LogEvent(true, LogType_Normal, LOG_CORE_EVENTS, LogModule_Database, "Query", "Schema fingerprint \"%s\" was matched, tables check was skipped", sHash);
+        return;
+    }
+    
+    // Create and check tables
+    SQLBaseCreate__(MySQL, false);
+}
+
+/**
+ * @brief Callback for a failed schema fingerprint transaction.
+ * 
+ * @param hDatabase         Handle to the database connection.
+ * @param iTicket           The request ticket.
+ * @param numQueries        Number of queries executed in the transaction.
+ * @param sError            Error string if there was an error.
+ * @param iFail             Index of the query that failed, or -1 if something else.
+ * @param iData             An array of each data value passed.
+ **/
+public void SQLTxnMetaFailure_Callback(Database hDatabase, int iTicket, int numQueries, char[] sError, int iFail, any[] iData)
+{
+    // Gets type of connection
+    bool MySQL = SQLBaseUntrack__(iTicket);
+    
+    // If invalid query handle, then log error
+    if (hDatabase == null || hasLength(sError))
+    {
+        // Unexpected error, log it
+        LogEvent(false, LogType_Error, LOG_CORE_EVENTS, LogModule_Database, "Query", "ID: \"%d\" - \"%s\"", iFail, sError);
+    }
+    
+    // Validate database
+    if (gServerData.DBI != null)
+    {
+        // Create and check tables without the fingerprint
+        SQLBaseCreate__(MySQL, false);
+    }
+}
+
+/**
+ * @brief Callback for a successful leaderboard transaction.
+ * 
+ * @param hDatabase         Handle to the database connection.
+ * @param iTicket           The request ticket.
+ * @param numQueries        Number of queries executed in the transaction.
+ * @param hResults          An array of DBResultSet results, one for each of numQueries. They are closed automatically.
+ * @param nColumn           An array with the column type of each query.
+ **/
+public void SQLTxnTop_Callback(Database hDatabase, int iTicket, int numQueries, DBResultSet[] hResults, any[] nColumn)
+{
+    // Release the ticket
+    SQLBaseUntrack__(iTicket);
+    
+    // If cache wasn't created, then create
+    if (gServerData.Top == null)
+    {
+        gServerData.Top = new ArrayList(3);
+    }
+    
+    // Clear the cache
+    gServerData.Top.Clear();
+    
+    // i = query index
+    for (int i = 0; i < numQueries; i++)
+    {
+        // Validate total amount
+        if (view_as<ColumnType>(nColumn[i]) == ColumnType_Default)
+        {
+            // Gets amount of rows
+            gServerData.TopTotal = hResults[i].FetchRow() ? hResults[i].FetchInt(0) : 0;
+            continue;
+        }
+        
+        // Players were found, get data from the rows
+        while (hResults[i].FetchRow())
+        {
+            // Push data into array
+            int iD = gServerData.Top.Push(nColumn[i]);
+            gServerData.Top.Set(iD, hResults[i].FetchInt(0), 1);
+            gServerData.Top.Set(iD, hResults[i].FetchInt(1), 2);
+        }
+    }
+}
+
+/**
+ * @brief Callback for a successful loading transaction.
+ * 
+ * @param hDatabase         Handle to the database connection.
+ * @param iTicket           The request ticket.
+ * @param numQueries        Number of queries executed in the transaction.
+ * @param hResults          An array of DBResultSet results, one for each of numQueries. They are closed automatically.
+ * @param iData             An array of each data value passed.
+ **/
+public void SQLTxnLoad_Callback(Database hDatabase, int iTicket, int numQueries, DBResultSet[] hResults, any[] iData)
+{
+    // Gets the array with user ids
+    ArrayList hClients = SQLBaseUntrack__(iTicket);
+    
+    // Initialize some variables 
+    static char sKey[SMALL_LINE_LENGTH]; ProfileData mProfile; int iField;
+    
+    // Client was found, get data from the rows
+    if (hResults[0].FieldNameToNum("account_id", iField))
+    {
+        while (hResults[0].FetchRow())
+        {
+            // Validate request
+            hResults[0].FetchString(iField, sKey, sizeof(sKey));
+            if (gServerData.Pending.GetArray(sKey, mProfile, sizeof(mProfile)) && mProfile.Ticket == iTicket)
+            {
+                // Sets profile data
+                SQLBaseSelect__(mProfile, hResults[0]);
+                
+                // Profile was found
+                mProfile.Found = true;
+                gServerData.Pending.SetArray(sKey, mProfile, sizeof(mProfile));
+            }
+        }
+    }
+
+    // Client was found, get weapons from the rows
+    while (hResults[1].FetchRow())
+    {
+        // Validate request
+        hResults[1].FetchString(0, sKey, sizeof(sKey));
+        if (gServerData.Pending.GetArray(sKey, mProfile, sizeof(mProfile)) && mProfile.Ticket == iTicket)
+        {
+            // Sets profile data
+            SQLBaseExtract__(mProfile, hResults[1]);
+            gServerData.Pending.SetArray(sKey, mProfile, sizeof(mProfile));
+        }
+    }
+    
+    // Client was found, get rank from the rows
+    while (hResults[2].FetchRow())
+    {
+        // Validate request
+        hResults[2].FetchString(0, sKey, sizeof(sKey));
+        if (gServerData.Pending.GetArray(sKey, mProfile, sizeof(mProfile)) && mProfile.Ticket == iTicket)
+        {
+            // Sets profile rank
+            mProfile.Rank = hResults[2].FetchInt(1);
+            gServerData.Pending.SetArray(sKey, mProfile, sizeof(mProfile));
+        }
+    }
+    
+    // i = array index
+    int iSize = hClients.Length;
+    for (int i = 0; i < iSize; i++)
+    {
+        // Make sure the client didn't disconnect while the thread was running
+        int client = GetClientOfUserId(hClients.Get(i));
+        if (!client || !gClientData[client].AccountID)
+        {
+            continue;
+        }
+        
+        // Validate request
+        IntToString(gClientData[client].AccountID, sKey, sizeof(sKey));
+        if (!gServerData.Pending.GetArray(sKey, mProfile, sizeof(mProfile)) || mProfile.Ticket != iTicket)
+        {
+            continue;
+        }
+        
+        // Profile is ready
+        mProfile.Ready = true;
+        gServerData.Pending.SetArray(sKey, mProfile, sizeof(mProfile));
+        
+        // If client already joined, then sets client data
+        if (mProfile.Waiting)
+        {
+            SQLBaseApply__(client);
+        }
+    }
+    
+    // Close list
+    delete hClients;
+}
+
+/**
+ * @brief Callback for a failed loading transaction.
+ * 
+ * @param hDatabase         Handle to the database connection.
+ * @param iTicket           The request ticket.
+ * @param numQueries        Number of queries executed in the transaction.
+ * @param sError            Error string if there was an error.
+ * @param iFail             Index of the query that failed, or -1 if something else.
+ * @param iData             An array of each data value passed.
+ **/
+public void SQLTxnLoadFailure_Callback(Database hDatabase, int iTicket, int numQueries, char[] sError, int iFail, any[] iData)
+{
+    // Gets the array with user ids
+    ArrayList hClients = SQLBaseUntrack__(iTicket);
+    
+    // Unexpected error, log it
+    LogEvent(false, LogType_Error, LOG_CORE_EVENTS, LogModule_Database, "Query", "ID: \"%d\" - \"%s\"", iFail, sError);
+    
+    // i = array index
+    static char sKey[SMALL_LINE_LENGTH]; ProfileData mProfile;
+    int iSize = hClients.Length;
+    for (int i = 0; i < iSize; i++)
+    {
+        // Validate client
+        int client = GetClientOfUserId(hClients.Get(i));
+        if (!client)
+        {
+            continue;
+        }
+        
+        // Remove profile of this request, so the joining will request it again
+        IntToString(gClientData[client].AccountID, sKey, sizeof(sKey));
+        if (gServerData.Pending.GetArray(sKey, mProfile, sizeof(mProfile)) && mProfile.Ticket == iTicket)
+        {
+            delete mProfile.Cart;
+            gServerData.Pending.Remove(sKey);
+        }
+    }
+    
+    // Close list
+    delete hClients;
+}
+
+/**
+ * @brief Callback for a successful bulk saving transaction.
+ * 
+ * @param hDatabase         Handle to the database connection.
+ * @param iTicket           The request ticket.
+ * @param numQueries        Number of queries executed in the transaction.
+ * @param hResults          An array of DBResultSet results, one for each of numQueries. They are closed automatically.
+ * @param iRows             An array with amount of rows for each query.
+ **/
+public void SQLTxnSave_Callback(Database hDatabase, int iTicket, int numQueries, DBResultSet[] hResults, any[] iRows)
+{
+    // Gets the request time
+    float flTime; SQLBaseUntrack__(iTicket, flTime);
+    
+    // Log database saving info
+    LogEvent(true, LogType_Normal, LOG_CORE_EVENTS, LogModule_Database, "Query", "Players were saved. Rows: \"%d\" - Time: \"%.4f\" sec", iRows[0], flTime);
+}
+
+/**
+ * @brief Callback for a failed bulk saving transaction.
+ * 
+ * @param hDatabase         Handle to the database connection.
+ * @param iTicket           The request ticket.
+ * @param numQueries        Number of queries executed in the transaction.
+ * @param sError            Error string if there was an error.
+ * @param iFail             Index of the query that failed, or -1 if something else.
+ * @param iRows             An array with amount of rows for each query.
+ **/
+public void SQLTxnSaveFailure_Callback(Database hDatabase, int iTicket, int numQueries, char[] sError, int iFail, any[] iRows)
+{
+    // Release the ticket
+    SQLBaseUntrack__(iTicket);
+    
+    // Unexpected error, log it
+    LogEvent(false, LogType_Error, LOG_CORE_EVENTS, LogModule_Database, "Query", "ID: \"%d\" - \"%s\"", iFail, sError);
+}
+
+/**
+ * @brief Callback for a successful outbox storing transaction.
+ * 
+ * @param hDatabase         Handle to the database connection.
+ * @param iTicket           The request ticket.
+ * @param numQueries        Number of queries executed in the transaction.
+ * @param hResults          An array of DBResultSet results, one for each of numQueries. They are closed automatically.
+ * @param iRows             An array with amount of saved rows for each query.
+ **/
+public void SQLTxnOutbox_Callback(Database hDatabase, int iTicket, int numQueries, DBResultSet[] hResults, any[] iRows)
+{
+    // Gets the stored requests
+    float flTime; DataPack hPack = SQLBaseUntrack__(iTicket, flTime);
+    
+    // Close pack
+    delete hPack;
+    
+    // i = query index
+    for (int i = 0; i < numQueries; i++)
+    {
+        // Validate bulk saving request
+        if (iRows[i])
+        {
+            /// The time of bulk saving is counted from the storing till the replay
+            int iD = gServerData.OutboxSaves.Push(hResults[i].InsertId);
+            gServerData.OutboxSaves.Set(iD, iRows[i], 1);
+            gServerData.OutboxSaves.Set(iD, SQLBaseClock__() - flTime, 2);
+        }
+    }
+    
+    // Sent stored requests
+    DataBaseOnReplay();
+}
+
+/**
+ * @brief Callback for a failed outbox storing transaction.
+ * 
+ * @param hDatabase         Handle to the database connection.
+ * @param iTicket           The request ticket.
+ * @param numQueries        Number of queries executed in the transaction.
+ * @param sError            Error string if there was an error.
+ * @param iFail             Index of the query that failed, or -1 if something else.
+ * @param iRows             An array with amount of saved rows for each query.
+ **/
+public void SQLTxnOutboxFailure_Callback(Database hDatabase, int iTicket, int numQueries, char[] sError, int iFail, any[] iRows)
+{
+    // Gets the stored requests
+    DataPack hPack = SQLBaseUntrack__(iTicket);
+    
+    // Unexpected error, log it
+    LogEvent(false, LogType_Error, LOG_CORE_EVENTS, LogModule_Database, "Query", "Outbox: \"%s\"", sError);
+    
+    // If database doesn't exist, then stop
+    if (gServerData.DBI == null)
+    {
+        delete hPack;
+        return;
+    }
+    
+    // Initialize request char
+    static char sRequest[DATABASE_BULK_LENGTH]; 
+    
+    // Creates a new transaction object
+    Transaction hTxn = new Transaction();
+    
+    // i = query index
+    hPack.Reset();
+    for (int i = 0; i < numQueries; i++)
+    {
+        // Adds a query to the transaction
+        hPack.ReadString(sRequest, sizeof(sRequest));
+        hTxn.AddQuery(sRequest);
+    }
+    
+    // Close pack
+    delete hPack;
+    
+    /// Requests weren't stored, so they are sent directly
+    gServerData.DBI.Execute(hTxn, SQLTxnSuccess_Callback, SQLTxnFailure_Callback, SQLBaseTrack__(FactoryType_Update, TransactionType_Flush), DBPrio_Low); 
+}
+
+/**
+ * @brief Callback for a successful outbox replaying transaction.
+ * 
+ * @param hDatabase         Handle to the database connection.
+ * @param iTicket           The request ticket.
+ * @param numQueries        Number of queries executed in the transaction.
+ * @param hResults          An array of DBResultSet results, one for each of numQueries. They are closed automatically.
+ * @param iData             An array of each outbox request id.
+ **/
+public void SQLTxnReplay_Callback(Database hDatabase, int iTicket, int numQueries, DBResultSet[] hResults, any[] iData)
+{
+    // Gets the id of the last sent outbox request
+    int iLast = SQLBaseUntrack__(iTicket);
+    
+    // i = query index
+    for (int i = 0; i < numQueries; i++)
+    {
+        // Validate bulk saving request
+        int iD = gServerData.OutboxSaves.FindValue(iData[i], 0);
+        if (iD != -1)
+        {
+            // Log database saving info
+            LogEvent(true, LogType_Normal, LOG_CORE_EVENTS, LogModule_Database, "Query", "Players were saved. Rows: \"%d\" - Time: \"%.4f\" sec", gServerData.OutboxSaves.Get(iD, 1), SQLBaseClock__() - view_as<float>(gServerData.OutboxSaves.Get(iD, 2)));
+            gServerData.OutboxSaves.Erase(iD);
+        }
+    }
+    
+    // If outbox was closed, then stop
+    if (gServerData.Outbox == null)
+    {
+        gServerData.OutboxBusy = false;
+        return;
+    }
+    
+    // Initialize request char
+    static char sRequest[BIG_LINE_LENGTH]; 
+    
+    /// Outbox is released after the removal, so the next batch can't read these requests again
+    FormatEx(sRequest, sizeof(sRequest), "DELETE FROM `%s` WHERE `id` <= %d;", DATABASE_OUTBOX, iLast);
+    gServerData.Outbox.Query(SQLBaseRemove_Callback, sRequest, SQLBaseTrack__(FactoryType_Outbox), DBPrio_Low);
+}
+
+/**
+ * @brief Callback for a failed outbox replaying transaction.
+ * 
+ * @param hDatabase         Handle to the database connection.
+ * @param iTicket           The request ticket.
+ * @param numQueries        Number of queries executed in the transaction.
+ * @param sError            Error string if there was an error.
+ * @param iFail             Index of the query that failed, or -1 if something else.
+ * @param iData             An array of each outbox request id.
+ **/
+public void SQLTxnReplayFailure_Callback(Database hDatabase, int iTicket, int numQueries, char[] sError, int iFail, any[] iData)
+{
+    // Release the ticket
+    SQLBaseUntrack__(iTicket);
+    
+    // Outbox was released, requests are kept until the next flush
+    gServerData.OutboxBusy = false;
+    
+    // Unexpected error, log it
+    LogEvent(false, LogType_Error, LOG_CORE_EVENTS, LogModule_Database, "Query", "Outbox ID: \"%d\" - \"%s\"", (iFail != -1) ? iData[iFail] : iFail, sError);
+    
+    // If connection was failed or outbox was closed, then stop
+    if (iFail == -1 || gServerData.Outbox == null)
+    {
+        return;
+    }
+    
+    /// The oldest requests are sent first, so the same request fails again until it is removed
+    int iD = iData[iFail];
+    if (gServerData.OutboxFailID != iD)
+    {
+        gServerData.OutboxFailID = iD;
+        gServerData.OutboxFailCount = 0;
+    }
+    
+    // Validate attempts
+    if (++gServerData.OutboxFailCount >= DATABASE_OUTBOX_ATTEMPTS)
+    {
+        // Move request out of the outbox
+        SQLBaseOutboxDead__(iD, sError);
+        
+        // Resets failures
+        gServerData.OutboxFailID = 0;
+        gServerData.OutboxFailCount = 0;
+        
+        // Sent the rest
+        DataBaseOnReplay();
+    }
+}
+
+/*
+ * Callbacks SQL functions.
+ */
+
+/**
+ * SQL: DROP, CREATE
+ * @brief Callback for receiving asynchronous database connection.
+ *
+ * @param hDatabase         Handle to the database connection.
+ * @param sError            Error string if there was an error.
+ * @param bDropping         Data passed in via the original threaded invocation.
+ **/
+public void SQLBaseConnect_Callback(Database hDatabase, char[] sError, bool bDropping)
+{
+    // If invalid query handle, then log error
+    if (hDatabase == null || hasLength(sError))
+    {
+        // Unexpected error, log it
+        LogEvent(false, LogType_Error, LOG_CORE_EVENTS, LogModule_Database, "Query", "%s", sError);
+    }
+    else
+    {
+        // Validate a global database handler
+        if (gServerData.DBI != null)
+        {
+            // Validate a new database is the same connection as old database
             if (hDatabase.IsSameConnection(gServerData.DBI))
             {
-                return;
+                return;
+            }
+            
+            // Close database
+            delete gServerData.DBI;
+        }
+
+        // Store into a global database handler
+        gServerData.DBI = hDatabase;
+        
+        /*______________________________________________________________________________*/
+        
+        // Gets driver for this connection
+        DBDriver hDriver = gServerData.DBI.Driver;
+        static char sDriver[SMALL_LINE_LENGTH]; 
+        hDriver.GetIdentifier(sDriver, sizeof(sDriver));
+        delete hDriver;
+
+        // Validate MySQL connection
+        bool MySQL = (sDriver[0] == 'm'); 
+        gServerData.MySQL = MySQL;
+        
+        // Validate SQLite connection
+        if (!MySQL)
+        {
+            // Sets pragmas before any other request
+            DataBaseOnPragma();
+        }
+
+        // Drop existing database
+        if (bDropping)
+        {
+            // Recreate tables
+            SQLBaseCreate__(MySQL, true);
+        }
+        else
+        {
+            // Creates a new transaction object
+            Transaction hTxn = new Transaction();
+            
+            // Initialize request char
+            static char sRequest[HUGE_LINE_LENGTH]; 
+            
+            // x = step index
+            for (int x = 0; x < 2; x++)
+            {
+                // Generate request
+                SQLBaseFactory__(MySQL, sRequest, sizeof(sRequest), ColumnType_Default, FactoryType_Meta, x);
+                
+                // Adds a query to the transaction
+                hTxn.AddQuery(sRequest);
+            }
+            
+            // Sent a transaction 
+            gServerData.DBI.Execute(hTxn, SQLTxnMeta_Callback, SQLTxnMetaFailure_Callback, SQLBaseTrack__(FactoryType_Meta, MySQL), DBPrio_High); 
+        }
+        
+        // Opens the outbox
+        DataBaseOnOutboxInit();
+    }
+}
+
+/**
+ * SQL: INFO, DESCRIBE
+ * @brief Callback for receiving asynchronous database information.
+ *
+ * @param hDatabase         Parent object of the handle.
+ * @param hResult           Handle to the child object.
+ * @param MySQL             The type of connection. 
+ **/
+public void SQLBaseAdd_Callback(Database hDatabase, DBResultSet hResult, bool MySQL)
+{
+    // Initialize some variables
+    static char sColumn[SMALL_LINE_LENGTH]; ColumnType nColumn;
+    
+    // Initialize a column existance array
+    ArrayList hColumn = new ArrayList(SMALL_LINE_LENGTH);
+    
+    // Info was found, get name from the rows
+    while (hResult.FetchRow())
+    {
+        // Extract row name
+        hResult.FetchString(!MySQL, sColumn, sizeof(sColumn));
+
+        // Validate unique column
+        if (hColumn.FindString(sColumn) == -1)
+        {
+            // Push data into array
+            hColumn.PushString(sColumn);
+        }
+    }
+    
+    // Creates a new transaction object
+    Transaction hTxn = new Transaction();
+
+    // Initialize request char
+    static char sRequest[HUGE_LINE_LENGTH]; 
+    
+    // i = column index
+    int iSize = gServerData.Cols.Size;
+    for (int i = 0; i < iSize; i++)
+    {
+        // Gets string from the map
+        gServerData.Columns.GetKey(i, sColumn, sizeof(sColumn));
+        
+        // Validate non exist column
+        if (hColumn.FindString(sColumn) == -1)
+        {
+            // Gets column type
+            gServerData.Cols.GetValue(sColumn, nColumn);
+            
+            /// SQlite doesn't have column add unique feature
+            if (nColumn == ColumnType_AccountID && !MySQL)
+            {
+                // x = step index
+                for (int x = 0; x < 4; x++)
+                {
+                    // Generate request
+                    SQLBaseFactory__(MySQL, sRequest, sizeof(sRequest), nColumn, FactoryType_AddU, x);
+                    
+                    // Adds a query to the transaction
+                    hTxn.AddQuery(sRequest);
+                }
+                
+                /// Remove steam_id here, because we are recreate table before
+                hColumn.Erase(hColumn.FindString("steam_id"));
+            }
+            else
+            {
+                // Generate request
+                SQLBaseFactory__(MySQL, sRequest, sizeof(sRequest), nColumn, FactoryType_Add);
+                
+                // Adds a query to the transaction
+                hTxn.AddQuery(sRequest);
+                
+                /// Convert Steam_Auth2 column to a AccountID column only once !
+                if (nColumn == ColumnType_AccountID) 
+                {
+                    // Generate request
+                    SQLBaseFactory__(MySQL, sRequest, sizeof(sRequest), nColumn, FactoryType_Update);
+            
+                    // Adds a query to the transaction
+                    hTxn.AddQuery(sRequest);
+                }
+            }
+        }
+    }
+
+    // i = column index
+    iSize = hColumn.Length;
+    for (int i = 0; i < iSize; i++)
+    {
+        // Gets string from the array
+        hColumn.GetString(i, sColumn, sizeof(sColumn));
+        
+        // Validate not exist column
+        if (!gServerData.Cols.GetValue(sColumn, nColumn))
+        {
+            /// SQlite doesn't have column drop feature
+            if (MySQL)
+            {
+                // Generate request
+                SQLBaseFactory__(MySQL, sRequest, sizeof(sRequest), ColumnType_Default, FactoryType_Remove, _, sColumn);
+                
+                // Adds a query to the transaction
+                hTxn.AddQuery(sRequest);
+            }
+            else
+            {
+                // x = step index
+                for (int x = 0; x < 4; x++)
+                {
+                    // Generate request
+                    SQLBaseFactory__(MySQL, sRequest, sizeof(sRequest), ColumnType_Default, FactoryType_Remove, x);
+                    
+                    // Adds a query to the transaction
+                    hTxn.AddQuery(sRequest);
+                }
+                
+                // Stop loop
+                break;
+            }
+        }
+    }
+    
+    // Gets fingerprint of the current schema
+    SQLBaseFingerprint__(MySQL, sColumn, sizeof(sColumn));
+    
+    /// Stored with the changes, so a failed update is checked again on the next connection
+    SQLBaseFactory__(MySQL, sRequest, sizeof(sRequest), ColumnType_Default, FactoryType_Meta, 2, sColumn);
+    
+    // Adds a query to the transaction
+    hTxn.AddQuery(sRequest);
+    
+    // Sent a transaction 
+    gServerData.DBI.Execute(hTxn, SQLTxnSuccess_Callback, SQLTxnFailure_Callback, SQLBaseTrack__(FactoryType_Add, TransactionType_Create), DBPrio_Normal); 
+    
+    // Close list
+    delete hColumn;
+}
+
+/**
+ * SQL: SELECT
+ * @brief Sets profile data from the current row of the main table.
+ *
+ * @param mProfile          The profile data.
+ * @param hResult           Handle to the result set.
+ **/
+void SQLBaseSelect__(ProfileData mProfile, DBResultSet hResult)
+{
+    // Initialize some variables 
+    static char sColumn[SMALL_LINE_LENGTH]; ColumnType nColumn; int iIndex;
+
+    // i = field index
+    int iCount = hResult.FieldCount;
+    for (int i = 0; i < iCount; i++)
+    {
+        // Gets name of the field
+        hResult.FieldNumToName(i, sColumn, sizeof(sColumn));
+
+        // Validate that field is exist
+        if (gServerData.Cols.GetValue(sColumn, nColumn))
+        {
+            // Sets profile data
+            switch (nColumn)
+            {
+                case ColumnType_ID :     mProfile.DataID = hResult.FetchInt(i); 
+                case ColumnType_Money :  mProfile.Money  = hResult.FetchInt(i); 
+                case ColumnType_Level :  mProfile.Level  = hResult.FetchInt(i);
+                case ColumnType_Exp :    mProfile.Exp    = hResult.FetchInt(i); 
+                case ColumnType_Zombie :
+                {
+                    hResult.FetchString(i, sColumn, sizeof(sColumn)); iIndex = ClassNameToIndex(sColumn);
+                    mProfile.ZombieClassNext = (iIndex != -1) ? iIndex : 0;
+                }
+                case ColumnType_Human :
+                {
+                    hResult.FetchString(i, sColumn, sizeof(sColumn)); iIndex = ClassNameToIndex(sColumn);
+                    mProfile.HumanClassNext  = (iIndex != -1) ? iIndex : 0;
+                }
+                case ColumnType_Costume :
+                {
+                    // If costumes is disabled, then skip
+                    if (!gCvarList.COSTUMES.BoolValue)
+                    {
+                        continue;
+                    }
+                    
+                    hResult.FetchString(i, sColumn, sizeof(sColumn));
+                    mProfile.Costume = CostumesNameToIndex(sColumn);
+                }
+                case ColumnType_Vision : mProfile.Vision = view_as<bool>(hResult.FetchInt(i));
+                case ColumnType_Time :   mProfile.Time   = hResult.FetchInt(i);
+            }
+        }
+    }
+}
+
+/**
+ * SQL: EXTRACT
+ * @brief Adds the weapon from the current row of the child table to the profile cart.
+ *
+ * @param mProfile          The profile data.
+ * @param hResult           Handle to the result set.
+ **/
+void SQLBaseExtract__(ProfileData mProfile, DBResultSet hResult)
+{
+    // Gets weapon name from the table 
+    static char sWeapon[SMALL_LINE_LENGTH];
+    hResult.FetchString(1, sWeapon, sizeof(sWeapon));
+    
+    // Validate index
+    int iIndex = WeaponsNameToIndex(sWeapon);
+    if (iIndex != -1)
+    {   
+        // If array hasn't been created, then create
+        if (mProfile.Cart == null)
+        {
+            // Initialize a default cart array
+            mProfile.Cart = new ArrayList();
+        }
+
+        // Push data into array
+        mProfile.Cart.Push(iIndex);
+    }
+}
+
+/**
+ * SQL: INSERT
+ * @brief Callback for receiving asynchronous database query results.
+ *
+ * @param hDatabase         Parent object of the handle.
+ * @param hResult           Handle to the child object.
+ * @param sError            Error string if there was an error.
+ * @param iTicket           The request ticket.
+ **/
+public void SQLBaseInsert_Callback(Database hDatabase, DBResultSet hResult, char[] sError, int iTicket)
+{
+    // Gets client index from the user id
+    int client = GetClientOfUserId(SQLBaseUntrack__(iTicket));
+    
+    // Make sure the client didn't disconnect while the thread was running
+    if (IsPlayerExist(client, false))
+    {
+        // If invalid query handle, then log error
+        if (hDatabase == null || hResult == null || hasLength(sError))
+        {
+            // Unexpected error, log it
+            LogEvent(false, LogType_Error, LOG_CORE_EVENTS, LogModule_Database, "Query", "%s", sError);
+        }
+        else
+        {
+            // Sets client data
+            gClientData[client].DataID = hResult.InsertId;
+            gClientData[client].Money  = gCvarList.ACCOUNT_CONNECT.IntValue;
+            
+            // Mark all columns as changed
+            gClientData[client].DataBits |= DATABASE_BITS;
+        }
+    } 
+}
+ 
+/**
+ * SQL: UPDATE
+ * @brief Callback for receiving asynchronous database query results.
+ *
+ * @param hDatabase         Parent object of the handle.
+ * @param hResult           Handle to the child object.
+ * @param sError            Error string if there was an error.
+ * @param iTicket           The request ticket.
+ **/
+public void SQLBaseUpdate_Callback(Database hDatabase, DBResultSet hResult, char[] sError, int iTicket)
+{
+    // Release the ticket
+    SQLBaseUntrack__(iTicket);
+    
+    // If invalid query handle, then log error
+    if (hDatabase == null || hResult == null || hasLength(sError))
+    {
+        // Unexpected error, log it
+        LogEvent(false, LogType_Error, LOG_CORE_EVENTS, LogModule_Database, "Query", "%s", sError);
+    }
+}
+
+/**
+ * SQL: SELECT
+ * @brief Callback for receiving the oldest stored outbox requests.
+ *
+ * @param hDatabase         Parent object of the handle.
+ * @param hResult           Handle to the child object.
+ * @param sError            Error string if there was an error.
+ * @param iTicket           The request ticket.
+ **/
+public void SQLBaseReplay_Callback(Database hDatabase, DBResultSet hResult, char[] sError, int iTicket)
+{
+    // Release the ticket
+    SQLBaseUntrack__(iTicket);
+    
+    // If invalid query handle, then log error
+    if (hDatabase == null || hResult == null || hasLength(sError))
+    {
+        // Unexpected error, log it
+        LogEvent(false, LogType_Error, LOG_CORE_EVENTS, LogModule_Database, "Query", "Outbox: \"%s\"", sError);
+        
+        // Outbox was released
+        gServerData.OutboxBusy = false;
+        return;
+    }
+    
+    // If database or outbox was closed, then stop
+    if (gServerData.DBI == null || gServerData.Outbox == null)
+    {
+        gServerData.OutboxBusy = false;
+        return;
+    }
+    
+    // Initialize request char
+    static char sRequest[DATABASE_BULK_LENGTH]; 
+    
+    // Creates a new transaction object
+    Transaction hTxn = new Transaction(); int iLast; int iCount;
+    
+    // Requests were found, get data from the rows
+    while (hResult.FetchRow())
+    {
+        // Gets request from the table
+        iLast = hResult.FetchInt(0);
+        hResult.FetchString(1, sRequest, sizeof(sRequest));
+        
+        // Adds a query to the transaction
+        hTxn.AddQuery(sRequest, iLast); iCount++;
+    }
+    
+    // Validate requests
+    if (!iCount)
+    {
+        delete hTxn;
+        
+        // Outbox was released
+        gServerData.OutboxBusy = false;
+        
+        // Sent loadings, which were waiting for the outbox
+        SQLBaseOutboxWake__();
+        return;
+    }
+    
+    // Sent a transaction 
+    gServerData.DBI.Execute(hTxn, SQLTxnReplay_Callback, SQLTxnReplayFailure_Callback, SQLBaseTrack__(FactoryType_Update, iLast), DBPrio_Low); /// Same priority as the flush, so player writes keep their order 
+}
+
+/**
+ * SQL: DELETE
+ * @brief Callback for removing the replayed outbox requests.
+ *
+ * @param hDatabase         Parent object of the handle.
+ * @param hResult           Handle to the child object.
+ * @param sError            Error string if there was an error.
+ * @param iTicket           The request ticket.
+ **/
+public void SQLBaseRemove_Callback(Database hDatabase, DBResultSet hResult, char[] sError, int iTicket)
+{
+    // Release the ticket
+    SQLBaseUntrack__(iTicket);
+    
+    // Outbox was released
+    gServerData.OutboxBusy = false;
+    
+    // If invalid query handle, then log error
+    if (hDatabase == null || hResult == null || hasLength(sError))
+    {
+        // Unexpected error, log it
+        LogEvent(false, LogType_Error, LOG_CORE_EVENTS, LogModule_Database, "Query", "Outbox: \"%s\"", sError);
+        return;
+    }
+    
+    // Sent the rest
+    DataBaseOnReplay();
+    
+    // Sent loadings, which were waiting for the outbox
+    SQLBaseOutboxWake__();
+}
+
+/**
+ * SQL: SELECT
+ * @brief Callback for checking stored outbox requests of the loading clients.
+ *
+ * @param hDatabase         Parent object of the handle.
+ * @param hResult           Handle to the child object.
+ * @param sError            Error string if there was an error.
+ * @param iTicket           The request ticket.
+ **/
+public void SQLBaseCheck_Callback(Database hDatabase, DBResultSet hResult, char[] sError, int iTicket)
+{
+    // Gets the ticket of the loading
+    int iLoad = SQLBaseUntrack__(iTicket);
+    
+    // If invalid query handle, then log error
+    if (hDatabase == null || hResult == null || hasLength(sError))
+    {
+        // Unexpected error, log it
+        LogEvent(false, LogType_Error, LOG_CORE_EVENTS, LogModule_Database, "Query", "Outbox: \"%s\"", sError);
+    }
+    /// Stored requests are replayed first, so the loading can't get the old data
+    else if (hResult.FetchRow() && gServerData.Outbox != null)
+    {
+        // Wait for the replay
+        gServerData.OutboxLoads.Push(iLoad);
+        DataBaseOnReplay();
+        return;
+    }
+    
+    // Sent a transaction 
+    SQLBaseLoad__(iLoad);
+}
+
+/*
+ * Menu database API.
+ */
+
+/**
+ * @brief Creates the leaderboard menu.
+ *
+ * @param client            The client index.
+ **/
+void DataBaseMenu(int client) 
+{
+    // Validate client
+    if (!IsPlayerExist(client, false))
+    {
+        return;
+    }
+
+    // Initialize variables
+    static char sBuffer[NORMAL_LINE_LENGTH];
+    static char sInfo[SMALL_LINE_LENGTH];
+
+    // Creates menu handle
+    Menu hMenu = new Menu(DataBaseMenuSlots);
+
+    // Sets language to target
+    SetGlobalTransTarget(client);
+    
+    // Sets title
+    hMenu.SetTitle("%t", "top menu");
+    
+    // i = column index
+    static const ColumnType nColumn[3] = { ColumnType_Level, ColumnType_Exp, ColumnType_Money };
+    static const char sColumn[3][SMALL_LINE_LENGTH] = { "top level", "top experience", "top money" };
+    for (int i = 0; i < sizeof(nColumn); i++)
+    {
+        // Format some chars for showing in menu
+        FormatEx(sBuffer, sizeof(sBuffer), "%t", sColumn[i]);
+        
+        // Show option
+        IntToString(view_as<int>(nColumn[i]), sInfo, sizeof(sInfo));
+        hMenu.AddItem(sInfo, sBuffer);
+    }
+    
+    // Sets exit button
+    hMenu.ExitButton = true;
+
+    // Sets options and display it
+    hMenu.OptionFlags = MENUFLAG_BUTTON_EXIT;
+    hMenu.Display(client, MENU_TIME_FOREVER); 
+}
+
+/**
+ * @brief Called when client selects option in the leaderboard menu, and handles it.
+ *  
+ * @param hMenu             The handle of the menu being used.
+ * @param mAction           The action done on the menu (see menus.inc, enum MenuAction).
+ * @param client            The client index.
+ * @param mSlot             The slot index selected (starting from 0).
+ **/ 
+public int DataBaseMenuSlots(Menu hMenu, MenuAction mAction, int client, int mSlot)
+{
+    // Switch the menu action
+    switch (mAction)
+    {
+        // Client hit 'Exit' button
+        case MenuAction_End :
+        {
+            delete hMenu;
+        }
+        
+        // Client selected an option
+        case MenuAction_Select :
+        {
+            // Validate client
+            if (!IsPlayerExist(client, false))
+            {
+                return;
+            }
+
+            // Gets menu info
+            static char sBuffer[SMALL_LINE_LENGTH];
+            hMenu.GetItem(mSlot, sBuffer, sizeof(sBuffer));
+            
+            // Opens the list menu
+            DataBaseTopMenu(client, view_as<ColumnType>(StringToInt(sBuffer)));
+        }
+    }
+}
+
+/**
+ * @brief Creates the leaderboard list menu from the cache.
+ *
+ * @param client            The client index.
+ * @param nColumn           The column type.
+ **/
+void DataBaseTopMenu(int client, ColumnType nColumn) 
+{
+    // Validate client
+    if (!IsPlayerExist(client, false))
+    {
+        return;
+    }
+
+    // Initialize variables
+    static char sBuffer[NORMAL_LINE_LENGTH];
+    static char sName[NORMAL_LINE_LENGTH];
+
+    // Creates menu handle
+    Menu hMenu = new Menu(DataBaseTopMenuSlots);
+
+    // Sets language to target
+    SetGlobalTransTarget(client);
+    
+    // Sets title
+    hMenu.SetTitle("%t", (nColumn == ColumnType_Level) ? "top level" : (nColumn == ColumnType_Exp) ? "top experience" : "top money");
+    
+    // i = array index
+    int iSize = (gServerData.Top != null) ? gServerData.Top.Length : 0; int iAmount;
+    for (int i = 0; i < iSize; i++)
+    {
+        // Validate column
+        if (view_as<ColumnType>(gServerData.Top.Get(i, 0)) != nColumn)
+        {
+            continue;
+        }
+        
+        // Gets player name
+        SQLBaseTopName__(gServerData.Top.Get(i, 1), sName, sizeof(sName));
+        
+        // Format some chars for showing in menu
+        FormatEx(sBuffer, sizeof(sBuffer), "%t", "top menu entry", ++iAmount, sName, gServerData.Top.Get(i, 2));
+        
+        // Show option
+        hMenu.AddItem("", sBuffer, ITEMDRAW_DISABLED);
+    }
+    
+    // If there are no cases, add an "(Empty)" line
+    if (!iAmount)
+    {
+        // Format some chars for showing in menu
+        FormatEx(sBuffer, sizeof(sBuffer), "%t", "empty");
+        hMenu.AddItem("empty", sBuffer, ITEMDRAW_DISABLED);
+    }
+    
+    // Sets exit and back button
+    hMenu.ExitBackButton = true;
+
+    // Sets options and display it
+    hMenu.OptionFlags = MENUFLAG_BUTTON_EXIT | MENUFLAG_BUTTON_EXITBACK;
+    hMenu.Display(client, MENU_TIME_FOREVER); 
+}
+
+/**
+ * @brief Called when client selects option in the leaderboard list menu, and handles it.
+ *  
+ * @param hMenu             The handle of the menu being used.
+ * @param mAction           The action done on the menu (see menus.inc, enum MenuAction).
+ * @param client            The client index.
+ * @param mSlot             The slot index selected (starting from 0).
+ **/ 
+public int DataBaseTopMenuSlots(Menu hMenu, MenuAction mAction, int client, int mSlot)
+{
+    // Switch the menu action
+    switch (mAction)
+    {
+        // Client hit 'Exit' button
+        case MenuAction_End :
+        {
+            delete hMenu;
+        }
+        
+        // Client hit 'Back' button
+        case MenuAction_Cancel :
+        {
+            if (mSlot == MenuCancel_ExitBack)
+            {
+                // Opens menu back
+                DataBaseMenu(client);
+            }
+        }
+    }
+}
+
+/*
+ * Stocks database API.
+ */
+
+/**
+ * @brief Queues a write request for the outbox.
+ *
+ * @param sRequest          The request string.
+ * @param iAccountID        (Optional) The account id, or 0 for requests of several clients.
+ * @param iRows             (Optional) The amount of rows of bulk saving request.
+ * @return                  True if request was queued, false if outbox is closed.
+ **/
+bool SQLBaseOutbox__(char[] sRequest, int iAccountID = 0, int iRows = 0)
+{
+    // If outbox doesn't exist, then stop
+    if (gServerData.Outbox == null)
+    {
+        return false;
+    }
+    
+    // If transaction wasn't created, then create
+    if (gServerData.OutboxTxn == null)
+    {
+        gServerData.OutboxTxn = new Transaction();
+        gServerData.OutboxPack = new DataPack();
+    }
+    
+    // Initialize request chars
+    static char sBuffer[DATABASE_BULK_LENGTH * 2 + 1]; static char sQuery[DATABASE_BULK_LENGTH * 2 + NORMAL_LINE_LENGTH];
+    
+    // Escape the request
+    gServerData.Outbox.Escape(sRequest, sBuffer, sizeof(sBuffer));
+    
+    // Adds a query to the transaction
+    FormatEx(sQuery, sizeof(sQuery), "INSERT INTO `%s` (`query`, `account`) VALUES ('%s', %d);", DATABASE_OUTBOX, sBuffer, iAccountID);
+    gServerData.OutboxTxn.AddQuery(sQuery, iRows);
+    
+    // Keep request, in case if the outbox fails to store it
+    gServerData.OutboxPack.WriteString(sRequest);
+    return true;
+}
+
+/**
+ * @brief Stores the queued write requests in the outbox with one local transaction.
+ *
+ * @note  The outbox is replayed when the requests are stored.
+ **/
+void SQLBaseOutboxSend__(/*void*/)
+{
+    // If nothing was queued, then replay
+    if (gServerData.OutboxTxn == null)
+    {
+        DataBaseOnReplay();
+        return;
+    }
+    
+    // Sent a transaction 
+    gServerData.Outbox.Execute(gServerData.OutboxTxn, SQLTxnOutbox_Callback, SQLTxnOutboxFailure_Callback, SQLBaseTrack__(FactoryType_Outbox, gServerData.OutboxPack), DBPrio_Low); /// Same priority as the flush, so player writes keep their order 
+    
+    // Transaction was sent
+    gServerData.OutboxTxn = null;
+    gServerData.OutboxPack = null;
+}
+
+/**
+ * @brief Closes the outbox, and sends loadings, which were waiting for it.
+ **/
+void SQLBaseOutboxClose__(/*void*/)
+{
+    // Close outbox
+    delete gServerData.Outbox;
+    delete gServerData.OutboxTxn;
+    delete gServerData.OutboxPack;
+    gServerData.OutboxBusy = false;
+    
+    // If lists weren't created, then stop
+    if (gServerData.OutboxLoads == null)
+    {
+        return;
+    }
+    
+    // Clear saves
+    gServerData.OutboxSaves.Clear();
+    
+    // Sent loadings, which were waiting for the outbox
+    SQLBaseOutboxWake__();
+}
+
+/**
+ * @brief Checks the outbox for stored requests of the loading clients.
+ *
+ * @param iTicket           The ticket of the loading.
+ **/
+void SQLBaseOutboxCheck__(int iTicket)
+{
+    // Initialize request chars
+    static char sRequest[FILE_LINE_LENGTH]; static char sList[CONSOLE_LINE_LENGTH]; 
+    
+    // Gets accounts of the loading
+    SQLBaseAccounts__(iTicket, sList, sizeof(sList));
+    
+    // Gets the first stored request
+    FormatEx(sRequest, sizeof(sRequest), "SELECT `id` FROM `%s` WHERE `account` IN (0,%s) LIMIT 1;", DATABASE_OUTBOX, sList);
+    gServerData.Outbox.Query(SQLBaseCheck_Callback, sRequest, SQLBaseTrack__(FactoryType_Outbox, iTicket), DBPrio_Low);
+}
+
+/**
+ * @brief Checks the outbox again for loadings, which were waiting for the replay.
+ **/
+void SQLBaseOutboxWake__(/*void*/)
+{
+    // Gets waiting loadings
+    ArrayList hLoads = gServerData.OutboxLoads.Clone();
+    gServerData.OutboxLoads.Clear();
+    
+    // i = array index
+    int iSize = hLoads.Length;
+    for (int i = 0; i < iSize; i++)
+    {
+        // Validate outbox
+        int iTicket = hLoads.Get(i);
+        if (gServerData.Outbox != null)
+        {
+            SQLBaseOutboxCheck__(iTicket);
+        }
+        else
+        {
+            SQLBaseLoad__(iTicket);
+        }
+    }
+    
+    // Close list
+    delete hLoads;
+}
+
+/**
+ * @brief Moves a failed request from the outbox to the dead-letter table.
+ *
+ * @param iD                The outbox request id.
+ * @param sError            The error string.
+ **/
+void SQLBaseOutboxDead__(int iD, char[] sError)
+{
+    // Initialize request chars
+    static char sBuffer[PLATFORM_LINE_LENGTH * 2 + 1]; static char sRequest[PLATFORM_LINE_LENGTH * 3];
+    
+    // Escape the error
+    if (!gServerData.Outbox.Escape(sError, sBuffer, sizeof(sBuffer))) sBuffer[0] = NULL_STRING[0];
+    
+    // Creates a new transaction object
+    Transaction hTxn = new Transaction();
+    
+    // Copy request to the dead-letter table
+    FormatEx(sRequest, sizeof(sRequest), "INSERT OR REPLACE INTO `%s` (`id`, `query`, `error`) SELECT `id`, `query`, '%s' FROM `%s` WHERE `id` = %d;", DATABASE_OUTBOX_DEAD, sBuffer, DATABASE_OUTBOX, iD);
+    hTxn.AddQuery(sRequest);
+    
+    // Remove request from the outbox
+    FormatEx(sRequest, sizeof(sRequest), "DELETE FROM `%s` WHERE `id` = %d;", DATABASE_OUTBOX, iD);
+    hTxn.AddQuery(sRequest);
+    
+    // Sent a transaction 
+    gServerData.Outbox.Execute(hTxn, SQLTxnSuccess_Callback, SQLTxnFailure_Callback, SQLBaseTrack__(FactoryType_Outbox, TransactionType_Flush), DBPrio_Low); 
+    
+    // Log the move
+    LogEvent(false, LogType_Error, LOG_CORE_EVENTS, LogModule_Database, "Query", "Outbox ID: \"%d\" failed %d times, moved to \"%s\"", iD, DATABASE_OUTBOX_ATTEMPTS, DATABASE_OUTBOX_DEAD);
+}
+
+/**
+ * @brief Loads the main row, the weapon cart and the rank of clients in one transaction.
+ *
+ * @param iTicket           The ticket of the loading.
+ **/
+void SQLBaseLoad__(int iTicket)
+{
+    // If database doesn't exist, then stop
+    if (gServerData.DBI == null)
+    {
+        // Close list
+        ArrayList hClients = SQLBaseUntrack__(iTicket);
+        delete hClients;
+        return;
+    }
+    
+    // Initialize request chars
+    static char sRequest[FILE_LINE_LENGTH]; static char sList[CONSOLE_LINE_LENGTH]; 
+    
+    // Gets accounts of the loading
+    SQLBaseAccounts__(iTicket, sList, sizeof(sList));
+    
+    // Creates a new transaction object
+    Transaction hTxn = new Transaction();
+    
+    // Generate request
+    SQLBaseFactory__(_, sRequest, sizeof(sRequest), ColumnType_Default, FactoryType_Select, _, sList);
+
+    // Adds a query to the transaction
+    hTxn.AddQuery(sRequest);
+    
+    // Generate request
+    SQLBaseFactory__(_, sRequest, sizeof(sRequest), ColumnType_Weapon, FactoryType_Select, _, sList);
+
+    // Adds a query to the transaction
+    hTxn.AddQuery(sRequest);
+    
+    // Generate request
+    SQLBaseFactory__(_, sRequest, sizeof(sRequest), ColumnType_Default, FactoryType_Rank, _, sList);
+
+    // Adds a query to the transaction
+    hTxn.AddQuery(sRequest);
+    
+    // Sent a transaction 
+    gServerData.DBI.Execute(hTxn, SQLTxnLoad_Callback, SQLTxnLoadFailure_Callback, iTicket, DBPrio_High); 
+}
+
+/**
+ * @brief Gets the list of account ids of the loading.
+ *
+ * @param iTicket           The ticket of the loading.
+ * @param sList             The string to return list in.
+ * @param iMaxLen           The lenght of string.
+ **/
+void SQLBaseAccounts__(int iTicket, char[] sList, int iMaxLen)
+{
+    // Gets the array with user ids
+    ArrayList hClients = gServerData.Queries.Get(iTicket, 2);
+    
+    /// Clients could disconnect while waiting, so the list is never empty
+    strcopy(sList, iMaxLen, "0");
+    
+    // i = array index
+    int iSize = hClients.Length;
+    for (int i = 0; i < iSize; i++)
+    {
+        // Validate client
+        int client = GetClientOfUserId(hClients.Get(i));
+        if (client && gClientData[client].AccountID)
+        {
+            // Adds account id to the list
+            Format(sList, iMaxLen, "%s,%d", sList, gClientData[client].AccountID);
+        }
+    }
+}
+
+/**
+ * @brief Adds all changed data of the client to the transaction.
+ *
+ * @param hTxn              The transaction handle.
+ * @param client            The client index.
+ * @return                  The amount of added requests.
+ **/
+int SQLBaseClient__(Transaction hTxn, int client)
+{
+    // Initialize request char
+    static char sRequest[HUGE_LINE_LENGTH]; int iCount;
+    
+    // Validate main columns
+    if (gClientData[client].DataBits & DATABASE_BITS)
+    {
+        // Generate request
+        SQLBaseFactory__(_, sRequest, sizeof(sRequest), ColumnType_Default, FactoryType_Update, client);
+        
+        // Adds a query to the transaction
+        SQLBaseWrite__(hTxn, sRequest, client); iCount++;
+        
+        // Resets changes
+        gClientData[client].DataBits &= ~DATABASE_BITS;
+    }
+    
+    // Validate cart, rows of a new client are stored after the insertion
+    if ((gClientData[client].DataBits & DATABASE_BIT(ColumnType_Weapon)) && gClientData[client].DataID > 0)
+    {
+        // Adds requests to the transaction
+        iCount += SQLBaseCart__(hTxn, client);
+        
+        // Resets changes
+        gClientData[client].DataBits &= ~DATABASE_BIT(ColumnType_Weapon);
+    }
+    
+    // Return amount
+    return iCount;
+}
+
+/**
+ * @brief Adds net inserts and deletes between the current and the stored cart to the transaction.
+ *
+ * @param hTxn              The transaction handle.
+ * @param client            The client index.
+ * @return                  The amount of added requests.
+ **/
+int SQLBaseCart__(Transaction hTxn, int client)
+{
+    // Initialize some variables
+    static char sRequest[HUGE_LINE_LENGTH]; static char sWeapon[SMALL_LINE_LENGTH]; int iCount;
+    
+    // Gets stored weapons, which weren't matched yet
+    ArrayList hStored = (gClientData[client].StoredCart != null) ? gClientData[client].StoredCart.Clone() : new ArrayList();
+    
+    // Validate cart
+    if (gClientData[client].DefaultCart != null)
+    {
+        // i = array index
+        int iSize = gClientData[client].DefaultCart.Length;
+        for (int i = 0; i < iSize; i++)
+        {
+            // Validate stored weapon
+            int iD = gClientData[client].DefaultCart.Get(i);
+            int iIndex = hStored.FindValue(iD);
+            if (iIndex != -1)
+            {
+                hStored.Erase(iIndex);
+                continue;
             }
             
-            // Close database
-            delete gServerData.DBI;
+            // Gets weapon name
+            WeaponsGetName(iD, sWeapon, sizeof(sWeapon));
+            
+            // Generate request
+            SQLBaseFactory__(_, sRequest, sizeof(sRequest), ColumnType_Weapon, FactoryType_Insert, client, sWeapon);
+            
+            // Adds a query to the transaction
+            SQLBaseWrite__(hTxn, sRequest, client); iCount++;
         }
-
-        // Store into a global database handler
-        gServerData.DBI = hDatabase;
+    }
+    
+    // i = array index
+    int iSize = hStored.Length;
+    for (int i = 0; i < iSize; i++)
+    {
+        // Gets weapon name
+        WeaponsGetName(hStored.Get(i), sWeapon, sizeof(sWeapon));
         
-        /*______________________________________________________________________________*/
+        // Generate request
+        SQLBaseFactory__(_, sRequest, sizeof(sRequest), ColumnType_Weapon, FactoryType_Delete, client, sWeapon);
         
-        // Creates a new transaction object
-        Transaction hTxn = new Transaction();
+        // Adds a query to the transaction
+        SQLBaseWrite__(hTxn, sRequest, client); iCount++;
+    }
+    
+    // Close list
+    delete hStored;
+    
+    // Remember the stored cart
+    delete gClientData[client].StoredCart;
+    gClientData[client].StoredCart = (gClientData[client].DefaultCart != null) ? gClientData[client].DefaultCart.Clone() : new ArrayList();
+    
+    // Return amount
+    return iCount;
+}
 
-        // Initialize request char
-        static char sRequest[HUGE_LINE_LENGTH]; 
-        
-        // Drop existing database
-        if (bDropping)
-        {
-            // Generate request
-            SQLBaseFactory__(_, sRequest, sizeof(sRequest), ColumnType_Default, FactoryType_Drop);
+/**
+ * @brief Adds a write request to the transaction, or stores it in the outbox.
+ *
+ * @param hTxn              The transaction handle.
+ * @param sRequest          The request string.
+ * @param client            (Optional) The client index.
+ **/
+void SQLBaseWrite__(Transaction hTxn, char[] sRequest, int client = 0)
+{
+    // Store request in the outbox
+    if (!SQLBaseOutbox__(sRequest, client ? gClientData[client].AccountID : 0))
+    {
+        // Adds a query to the transaction
+        hTxn.AddQuery(sRequest, client);
+    }
+}
 
-            // Adds a query to the transaction
-            hTxn.AddQuery(sRequest);
-        }
+/**
+ * @brief Sends a write transaction, or stores the queued requests in the outbox.
+ *
+ * @param hTxn              The transaction handle.
+ * @param mTransaction      The transaction type.
+ * @param mPriority         The priority of the transaction.
+ **/
+void SQLBaseSend__(Transaction hTxn, TransactionType mTransaction, DBPriority mPriority)
+{
+    // Validate outbox
+    if (gServerData.Outbox != null)
+    {
+        delete hTxn;
         
-        // Gets driver for this connection
-        DBDriver hDriver = gServerData.DBI.Driver;
-        static char sDriver[SMALL_LINE_LENGTH]; 
-        hDriver.GetIdentifier(sDriver, sizeof(sDriver));
-        delete hDriver;
+        // Sent stored requests
+        SQLBaseOutboxSend__();
+        return;
+    }
+    
+    // Sent a transaction 
+    gServerData.DBI.Execute(hTxn, SQLTxnSuccess_Callback, SQLTxnFailure_Callback, SQLBaseTrack__(FactoryType_Update, mTransaction), mPriority); 
+}
 
-        // Validate MySQL connection
-        bool MySQL = (sDriver[0] == 'm'); 
+/**
+ * @brief Creates tables and checks their columns.
+ *
+ * @param MySQL             The type of connection.
+ * @param bDropping         True to drop the main table before.
+ **/
+void SQLBaseCreate__(bool MySQL, bool bDropping)
+{
+    // Creates a new transaction object
+    Transaction hTxn = new Transaction();
 
-        // Execute requests
-        static const FactoryType mFactory[4] = { FactoryType_Create, FactoryType_Dump, FactoryType_Keys, FactoryType_Parent };
-        for (int x = 0; x < sizeof(mFactory); x++)
-        {        
-            // Generate request
-            SQLBaseFactory__(MySQL, sRequest, sizeof(sRequest), ColumnType_Default, mFactory[x]);
-        
-            // Adds a query to the transaction
-            hTxn.AddQuery(sRequest);
-        }
+    // Initialize request char
+    static char sRequest[HUGE_LINE_LENGTH]; 
+    
+    // Drop existing database
+    if (bDropping)
+    {
+        // Generate request
+        SQLBaseFactory__(_, sRequest, sizeof(sRequest), ColumnType_Default, FactoryType_Drop);
 
-        // Sent a transaction 
-        gServerData.DBI.Execute(hTxn, SQLTxnSuccess_Callback, SQLTxnFailure_Callback, MySQL ? TransactionType_Describe : TransactionType_Info, DBPrio_High); 
+        // Adds a query to the transaction
+        hTxn.AddQuery(sRequest);
+    }
+
+    // Execute requests
+    static const FactoryType mFactory[4] = { FactoryType_Create, FactoryType_Dump, FactoryType_Keys, FactoryType_Parent };
+    for (int x = 0; x < sizeof(mFactory); x++)
+    {        
+        // Generate request
+        SQLBaseFactory__(MySQL, sRequest, sizeof(sRequest), ColumnType_Default, mFactory[x]);
+    
+        // Adds a query to the transaction
+        hTxn.AddQuery(sRequest);
     }
+
+    // Sent a transaction 
+    gServerData.DBI.Execute(hTxn, SQLTxnSuccess_Callback, SQLTxnFailure_Callback, SQLBaseTrack__(FactoryType_Create, MySQL ? TransactionType_Describe : TransactionType_Info), DBPrio_High); 
 }
 
 /**
- * SQL: INFO, DESCRIBE
- * @brief Callback for receiving asynchronous database information.
+ * @brief Gets the SQLite pragma request.
  *
- * @param hDatabase         Parent object of the handle.
- * @param hResult           Handle to the child object.
- * @param MySQL             The type of connection. 
+ * @param sRequest          The request output.
+ * @param iMaxLen           The lenght of string.
+ * @param iStep             The step index.
+ * @param bProfile          True for the performance profile, false for the default pragmas.
  **/
-public void SQLBaseAdd_Callback(Database hDatabase, DBResultSet hResult, bool MySQL)
+void SQLBasePragma__(char[] sRequest, int iMaxLen, int iStep, bool bProfile)
 {
-    // Initialize some variables
-    static char sColumn[SMALL_LINE_LENGTH]; ColumnType nColumn;
+    // Gets step index
+    switch (iStep)
+    {
+        case 0 : strcopy(sRequest, iMaxLen, bProfile ? "PRAGMA journal_mode = WAL;" : "PRAGMA journal_mode = DELETE;");
+        case 1 : strcopy(sRequest, iMaxLen, bProfile ? "PRAGMA synchronous = NORMAL;" : "PRAGMA synchronous = FULL;");
+        case 2 : FormatEx(sRequest, iMaxLen, "PRAGMA mmap_size = %d;", bProfile ? DATABASE_SQLITE_MMAP : 0);
+        case 3 : FormatEx(sRequest, iMaxLen, "PRAGMA cache_size = %d;", bProfile ? DATABASE_SQLITE_CACHE : -2000);
+        case 4 : FormatEx(sRequest, iMaxLen, "PRAGMA wal_autocheckpoint = %d;", bProfile ? 0 : 1000); /// Profile checkpoints only between rounds and maps
+    }
+}
+
+/**
+ * @brief Measures single inserts and updates on the local SQLite database.
+ *
+ * @param hBench            The database handle.
+ * @param bProfile          True for the performance profile, false for the default pragmas.
+ * @param iRows             The amount of rows.
+ * @param flInsert          The inserts per second.
+ * @param flUpdate          The updates per second.
+ * @return                  True on success, false on error.
+ **/
+bool SQLBaseBenchmark__(Database hBench, bool bProfile, int iRows, float &flInsert, float &flUpdate)
+{
+    // Initialize request char
+    static char sRequest[NORMAL_LINE_LENGTH]; 
     
-    // Initialize a column existance array
-    ArrayList hColumn = new ArrayList(SMALL_LINE_LENGTH);
+    // x = step index
+    for (int x = 0; x < DATABASE_SQLITE_PRAGMAS; x++)
+    {
+        // Sets pragmas
+        SQLBasePragma__(sRequest, sizeof(sRequest), x, bProfile);
+        SQL_FastQuery(hBench, sRequest);
+    }
     
-    // Info was found, get name from the rows
-    while (hResult.FetchRow())
+    // Creates a new table
+    FormatEx(sRequest, sizeof(sRequest), "DROP TABLE IF EXISTS `%s`;", DATABASE_BENCH);
+    SQL_FastQuery(hBench, sRequest);
+    FormatEx(sRequest, sizeof(sRequest), "CREATE TABLE `%s` (`id` INTEGER PRIMARY KEY NOT NULL, `money` INTEGER NOT NULL DEFAULT 0);", DATABASE_BENCH);
+    if (!SQL_FastQuery(hBench, sRequest))
     {
-        // Extract row name
-        hResult.FetchString(!MySQL, sColumn, sizeof(sColumn));
-
-        // Validate unique column
-        if (hColumn.FindString(sColumn) == -1)
-        {
-            // Push data into array
-            hColumn.PushString(sColumn);
-        }
+        return false;
     }
     
-    // Creates a new transaction object
-    Transaction hTxn = new Transaction();
+    // Initialize the profiler
+    Profiler hProfiler = new Profiler();
+    
+    /// Each request is committed alone, like the outbox writes
+    hProfiler.Start();
+    for (int i = 1; i <= iRows; i++)
+    {
+        FormatEx(sRequest, sizeof(sRequest), "INSERT INTO `%s` (`id`, `money`) VALUES (%d, %d);", DATABASE_BENCH, i, i);
+        SQL_FastQuery(hBench, sRequest);
+    }
+    hProfiler.Stop();
+    flInsert = float(iRows) / (hProfiler.Time > 0.0 ? hProfiler.Time : 0.000001);
+    
+    // Measure updates
+    hProfiler.Start();
+    for (int i = 1; i <= iRows; i++)
+    {
+        FormatEx(sRequest, sizeof(sRequest), "UPDATE `%s` SET `money` = `money` + 1 WHERE `id` = %d;", DATABASE_BENCH, i);
+        SQL_FastQuery(hBench, sRequest);
+    }
+    hProfiler.Stop();
+    flUpdate = float(iRows) / (hProfiler.Time > 0.0 ? hProfiler.Time : 0.000001);
+    
+    // Remove the table
+    FormatEx(sRequest, sizeof(sRequest), "DROP TABLE IF EXISTS `%s`;", DATABASE_BENCH);
+    SQL_FastQuery(hBench, sRequest);
+    
+    // Close profiler
+    delete hProfiler;
+    return true;
+}
 
-    // Initialize request char
-    static char sRequest[HUGE_LINE_LENGTH]; 
+/**
+ * @brief Gets the fingerprint of the expected schema.
+ *
+ * @param MySQL             The type of connection.
+ * @param sHash             The string to return hash in.
+ * @param iMaxLen           The lenght of string.
+ **/
+void SQLBaseFingerprint__(bool MySQL, char[] sHash, int iMaxLen)
+{
+    // Initialize some variables
+    static char sColumn[SMALL_LINE_LENGTH]; static char sBuffer[PLATFORM_LINE_LENGTH]; ColumnType nColumn;
+    
+    // Initialize a sorted column array
+    ArrayList hColumn = new ArrayList(SMALL_LINE_LENGTH);
     
     // i = column index
     int iSize = gServerData.Cols.Size;
@@ -589,289 +3040,307 @@ public void SQLBaseAdd_Callback(Database hDatabase, DBResultSet hResult, bool My
         // Gets string from the map
         gServerData.Columns.GetKey(i, sColumn, sizeof(sColumn));
         
-        // Validate non exist column
-        if (hColumn.FindString(sColumn) == -1)
-        {
-            // Gets column type
-            gServerData.Cols.GetValue(sColumn, nColumn);
-            
-            /// SQlite doesn't have column add unique feature
-            if (nColumn == ColumnType_AccountID && !MySQL)
-            {
-                // x = step index
-                for (int x = 0; x < 4; x++)
-                {
-                    // Generate request
-                    SQLBaseFactory__(MySQL, sRequest, sizeof(sRequest), nColumn, FactoryType_AddU, x);
-                    
-                    // Adds a query to the transaction
-                    hTxn.AddQuery(sRequest);
-                }
-                
-                /// Remove steam_id here, because we are recreate table before
-                hColumn.Erase(hColumn.FindString("steam_id"));
-            }
-            else
-            {
-                // Generate request
-                SQLBaseFactory__(MySQL, sRequest, sizeof(sRequest), nColumn, FactoryType_Add);
-                
-                // Adds a query to the transaction
-                hTxn.AddQuery(sRequest);
-                
-                /// Convert Steam_Auth2 column to a AccountID column only once !
-                if (nColumn == ColumnType_AccountID) 
-                {
-                    // Generate request
-                    SQLBaseFactory__(MySQL, sRequest, sizeof(sRequest), nColumn, FactoryType_Update);
-            
-                    // Adds a query to the transaction
-                    hTxn.AddQuery(sRequest);
-                }
-            }
-        }
+        // Push data into array
+        hColumn.PushString(sColumn);
     }
-
+    
+    /// Snapshot order isn't stable, so sort names before hashing
+    SortADTArray(hColumn, Sort_Ascending, Sort_String);
+    
+    // Format tables
+    FormatEx(sBuffer, sizeof(sBuffer), "%s;%s;%s", MySQL ? "MySQL" : "SQlite", DATABASE_MAIN, DATABASE_CHILD);
+    
     // i = column index
-    iSize = hColumn.Length;
     for (int i = 0; i < iSize; i++)
     {
         // Gets string from the array
         hColumn.GetString(i, sColumn, sizeof(sColumn));
         
-        // Validate not exist column
-        if (!gServerData.Cols.GetValue(sColumn, nColumn))
+        // Gets column type
+        gServerData.Cols.GetValue(sColumn, nColumn);
+        
+        // Format columns
+        Format(sBuffer, sizeof(sBuffer), "%s;%s:%d", sBuffer, sColumn, nColumn);
+    }
+    
+    // Close list
+    delete hColumn;
+    
+    /// FNV-1a 32-bit
+    int iHash = -2128831035; /// 0x811C9DC5
+    for (int i = 0; sBuffer[i] != NULL_STRING[0]; i++)
+    {
+        iHash ^= sBuffer[i];
+        iHash *= 16777619;
+    }
+    
+    // Format hash
+    FormatEx(sHash, iMaxLen, "%08X", iHash);
+}
+
+/**
+ * @brief Gets the time since the database module was started.
+ *
+ * @return                  The time in seconds.
+ **/
+float SQLBaseClock__(/*void*/)
+{
+    /// Stop only updates the end time, so the clock keeps running
+    gServerData.Clock.Stop();
+    return gServerData.Clock.Time;
+}
+
+/**
+ * @brief Starts tracking of a sent request.
+ *
+ * @param mFactory          The request type.
+ * @param data              (Optional) The data for the callback.
+ * @return                  The request ticket.
+ **/
+int SQLBaseTrack__(FactoryType mFactory, any data = 0)
+{
+    // Finds a free ticket
+    int iTicket = -1; int iSize = gServerData.Queries.Length;
+    for (int i = 0; i < iSize; i++)
+    {
+        // Validate free ticket
+        if (gServerData.Queries.Get(i, 1) == -1)
         {
-            /// SQlite doesn't have column drop feature
-            if (MySQL)
-            {
-                // Generate request
-                SQLBaseFactory__(MySQL, sRequest, sizeof(sRequest), ColumnType_Default, FactoryType_Remove, _, sColumn);
-                
-                // Adds a query to the transaction
-                hTxn.AddQuery(sRequest);
-            }
-            else
-            {
-                // x = step index
-                for (int x = 0; x < 4; x++)
-                {
-                    // Generate request
-                    SQLBaseFactory__(MySQL, sRequest, sizeof(sRequest), ColumnType_Default, FactoryType_Remove, x);
-                    
-                    // Adds a query to the transaction
-                    hTxn.AddQuery(sRequest);
-                }
-                
-                // Stop loop
-                break;
-            }
+            iTicket = i;
+            break;
         }
     }
     
-    // Sent a transaction 
-    gServerData.DBI.Execute(hTxn, SQLTxnSuccess_Callback, SQLTxnFailure_Callback, TransactionType_Create, DBPrio_Normal); 
+    // If all tickets are busy, then create
+    if (iTicket == -1)
+    {
+        iTicket = gServerData.Queries.Push(0.0);
+    }
+    
+    // Store request
+    gServerData.Queries.Set(iTicket, SQLBaseClock__(), 0);
+    gServerData.Queries.Set(iTicket, mFactory, 1);
+    gServerData.Queries.Set(iTicket, data, 2);
+    gServerData.InFlight++;
+    return iTicket;
+}
+
+/**
+ * @brief Stops tracking of a finished request and records its time.
+ *
+ * @param iTicket           The request ticket.
+ * @param flTime            (Optional) The time of the request in seconds.
+ * @return                  The data for the callback.
+ **/
+any SQLBaseUntrack__(int iTicket, float &flTime = 0.0)
+{
+    // Gets request data
+    flTime = SQLBaseClock__() - view_as<float>(gServerData.Queries.Get(iTicket, 0));
+    int iFactory = gServerData.Queries.Get(iTicket, 1);
+    any data = gServerData.Queries.Get(iTicket, 2);
+    
+    // Release the ticket
+    gServerData.Queries.Set(iTicket, -1, 1);
+    gServerData.InFlight--;
+    
+    // Validate factory block
+    while (gServerData.Stats.Length <= iFactory)
+    {
+        int iD = gServerData.Stats.Push(0);
+        gServerData.Stats.Set(iD, 0.0, StatsType_Max);
+        gServerData.Stats.Set(iD, 0, StatsType_Next);
+    }
     
-    // Close list
-    delete hColumn;
+    // Record the time in milliseconds
+    float flMs = flTime * 1000.0;
+    int iNext = gServerData.Stats.Get(iFactory, StatsType_Next);
+    gServerData.Stats.Set(iFactory, flMs, StatsType_Samples + iNext);
+    gServerData.Stats.Set(iFactory, (iNext + 1) % DATABASE_STATS_SAMPLES, StatsType_Next);
+    gServerData.Stats.Set(iFactory, gServerData.Stats.Get(iFactory, StatsType_Count) + 1, StatsType_Count);
+    if (flMs > view_as<float>(gServerData.Stats.Get(iFactory, StatsType_Max)))
+    {
+        gServerData.Stats.Set(iFactory, flMs, StatsType_Max);
+    }
+    return data;
 }
 
 /**
- * SQL: SELECT
- * @brief Callback for receiving asynchronous database query results.
+ * @brief Gets the timings of the requests.
  *
- * @param hDatabase         Parent object of the handle.
- * @param hResult           Handle to the child object.
- * @param sError            Error string if there was an error.
- * @param client            Data passed in via the original threaded invocation.
+ * @note  Percentiles are taken from the last DATABASE_STATS_SAMPLES requests.
+ *
+ * @param mFactory          The request type.
+ * @param flP50             The median time in milliseconds.
+ * @param flP95             The 95th percentile time in milliseconds.
+ * @param flMax             The maximum time in milliseconds.
+ * @return                  The amount of requests.
  **/
-public void SQLBaseSelect_Callback(Database hDatabase, DBResultSet hResult, char[] sError, int client)
+int SQLBaseStats__(FactoryType mFactory, float &flP50, float &flP95, float &flMax)
 {
-    // Make sure the client didn't disconnect while the thread was running
-    if (IsPlayerExist(client, false))
+    // Validate factory block
+    int iFactory = view_as<int>(mFactory);
+    if (iFactory >= gServerData.Stats.Length)
     {
-        // If invalid query handle, then log error
-        if (hDatabase == null || hResult == null || hasLength(sError))
-        {
-            // Unexpected error, log it
-            LogEvent(false, LogType_Error, LOG_CORE_EVENTS, LogModule_Database, "Query", "%s", sError);
-        }
-        else
-        {
-            // Initialize request char
-            static char sRequest[HUGE_LINE_LENGTH]; 
-
-            // Client was found, get data from the row
-            if (hResult.FetchRow())
-            {
-                // Initialize some variables 
-                static char sColumn[SMALL_LINE_LENGTH]; ColumnType nColumn; int iIndex;
- 
-                // i = field index
-                int iCount = hResult.FieldCount;
-                for (int i = 0; i < iCount; i++)
-                {
-                    // Gets name of the field
-                    hResult.FieldNumToName(i, sColumn, sizeof(sColumn));
-
-                    // Validate that field is exist
-                    if (gServerData.Cols.GetValue(sColumn, nColumn))
-                    {
-                        // Sets client data
-                        switch (nColumn)
-                        {
-                            case ColumnType_ID :     gClientData[client].DataID = hResult.FetchInt(i); 
-                            case ColumnType_Money :  gClientData[client].Money  = hResult.FetchInt(i); 
-                            case ColumnType_Level :  gClientData[client].Level  = hResult.FetchInt(i);
-                            case ColumnType_Exp :    gClientData[client].Exp    = hResult.FetchInt(i); 
-                            case ColumnType_Zombie :
-                            {
-                                hResult.FetchString(i, sColumn, sizeof(sColumn)); iIndex = ClassNameToIndex(sColumn);
-                                gClientData[client].ZombieClassNext = (iIndex != -1) ? iIndex : 0;
-                            }
-                            case ColumnType_Human :
-                            {
-                                hResult.FetchString(i, sColumn, sizeof(sColumn)); iIndex = ClassNameToIndex(sColumn);
-                                gClientData[client].HumanClassNext  = (iIndex != -1) ? iIndex : 0;
-                            }
-                            case ColumnType_Costume :
-                            {
-                                // If costumes is disabled, then skip
-                                if (!gCvarList.COSTUMES.BoolValue)
-                                {
-                                    continue;
-                                }
-                                
-                                hResult.FetchString(i, sColumn, sizeof(sColumn));
-                                gClientData[client].Costume = CostumesNameToIndex(sColumn);
-                            }
-                            case ColumnType_Vision : gClientData[client].Vision = view_as<bool>(hResult.FetchInt(i));
-                            case ColumnType_Time :   gClientData[client].Time   = hResult.FetchInt(i);
-                        }
-                    }
-                }
-                
-                // Generate request
-                SQLBaseFactory__(_, sRequest, sizeof(sRequest), ColumnType_Weapon, FactoryType_Select, client);
-                
-                // Sent a request
-                gServerData.DBI.Query(SQLBaseExtract_Callback, sRequest, client, DBPrio_Normal); 
-            }
-            else
-            {
-                // Generate request
-                SQLBaseFactory__(_, sRequest, sizeof(sRequest), ColumnType_AccountID, FactoryType_Insert, client);
-                
-                // Sent a request
-                gServerData.DBI.Query(SQLBaseInsert_Callback, sRequest, client, DBPrio_High); 
-            }
-            
-            // Client was loaded
-            gClientData[client].Loaded = true;
-        }
+        return 0;
+    }
+    
+    // Validate requests
+    int iCount = gServerData.Stats.Get(iFactory, StatsType_Count);
+    if (!iCount)
+    {
+        return 0;
+    }
+    
+    // Gets the samples
+    static float flSamples[DATABASE_STATS_SAMPLES];
+    int iSize = (iCount < DATABASE_STATS_SAMPLES) ? iCount : DATABASE_STATS_SAMPLES;
+    for (int i = 0; i < iSize; i++)
+    {
+        flSamples[i] = gServerData.Stats.Get(iFactory, StatsType_Samples + i);
     }
+    
+    // Sort samples
+    SortFloats(flSamples, iSize, Sort_Ascending);
+    
+    // Gets timings
+    flP50 = flSamples[((iSize - 1) * 50) / 100];
+    flP95 = flSamples[((iSize - 1) * 95) / 100];
+    flMax = gServerData.Stats.Get(iFactory, StatsType_Max);
+    return iCount;
 }
 
 /**
- * SQL: EXTRACT
- * @brief Callback for receiving asynchronous database query results.
+ * @brief Gets the name of the request type.
  *
- * @param hDatabase         Parent object of the handle.
- * @param hResult           Handle to the child object.
- * @param sError            Error string if there was an error.
- * @param client            Data passed in via the original threaded invocation.
+ * @param mFactory          The request type.
+ * @param sName             The string to return name in.
+ * @param iMaxLen           The lenght of string.
  **/
-public void SQLBaseExtract_Callback(Database hDatabase, DBResultSet hResult, char[] sError, int client)
+void SQLBaseFactoryName__(FactoryType mFactory, char[] sName, int iMaxLen)
 {
-    // Make sure the client didn't disconnect while the thread was running
-    if (IsPlayerExist(client, false))
+    static const char sFactory[][] = { "create", "drop", "dump", "keys", "parent", "add", "addu", "remove", "select", "update", "insert", "delete", "replace", "meta", "top", "rank", "pragma", "outbox" };
+    strcopy(sName, iMaxLen, (view_as<int>(mFactory) < sizeof(sFactory)) ? sFactory[view_as<int>(mFactory)] : "unknown");
+}
+
+/**
+ * @brief Gets the name of the leaderboard player.
+ *
+ * @param iAccountID        The account id.
+ * @param sName             The string to return name in.
+ * @param iMaxLen           The lenght of string.
+ **/
+void SQLBaseTopName__(int iAccountID, char[] sName, int iMaxLen)
+{
+    // i = client index
+    for (int i = 1; i <= MaxClients; i++)
     {
-        // If invalid query handle, then log error
-        if (hDatabase == null || hResult == null || hasLength(sError))
-        {
-            // Unexpected error, log it
-            LogEvent(false, LogType_Error, LOG_CORE_EVENTS, LogModule_Database, "Query", "%s", sError);
-        }
-        else
+        // Validate online player
+        if (gClientData[i].AccountID == iAccountID && IsPlayerExist(i, false))
         {
-            // Client was found, get data from all rows
-            while (hResult.FetchRow())
-            {
-                // Gets weapon name from the table 
-                static char sWeapon[SMALL_LINE_LENGTH];
-                hResult.FetchString(0, sWeapon, sizeof(sWeapon));
-                
-                // Validate index
-                int iIndex = WeaponsNameToIndex(sWeapon);
-                if (iIndex != -1)
-                {   
-                    // If array hasn't been created, then create
-                    if (gClientData[client].DefaultCart == null)
-                    {
-                        // Initialize a default cart array
-                        gClientData[client].DefaultCart = new ArrayList();
-                    }
-            
-                    // Push data into array
-                    gClientData[client].DefaultCart.Push(iIndex);
-                }
-            }
+            FormatEx(sName, iMaxLen, "%N", i);
+            return;
         }
     }
+    
+    /// Offline players are shown by the Steam2 id
+    FormatEx(sName, iMaxLen, "STEAM_1:%d:%d", iAccountID & 1, iAccountID >>> 1);
 }
 
 /**
- * SQL: INSERT
- * @brief Callback for receiving asynchronous database query results.
+ * @brief Sets client data from the pending profile.
  *
- * @param hDatabase         Parent object of the handle.
- * @param hResult           Handle to the child object.
- * @param sError            Error string if there was an error.
- * @param client            Data passed in via the original threaded invocation.
+ * @param client            The client index.
+ * @return                  True if profile was applied, false if it isn't ready.
  **/
-public void SQLBaseInsert_Callback(Database hDatabase, DBResultSet hResult, char[] sError, int client)
+bool SQLBaseApply__(int client)
 {
-    // Make sure the client didn't disconnect while the thread was running
-    if (IsPlayerExist(client, false))
+    // Gets pending profile
+    static char sKey[SMALL_LINE_LENGTH]; ProfileData mProfile;
+    IntToString(gClientData[client].AccountID, sKey, sizeof(sKey));
+    if (!gServerData.Pending.GetArray(sKey, mProfile, sizeof(mProfile)) || !mProfile.Ready)
     {
-        // If invalid query handle, then log error
-        if (hDatabase == null || hResult == null || hasLength(sError))
-        {
-            // Unexpected error, log it
-            LogEvent(false, LogType_Error, LOG_CORE_EVENTS, LogModule_Database, "Query", "%s", sError);
-        }
-        else
-        {
-            // Sets client data
-            gClientData[client].DataID = hResult.InsertId;
-            gClientData[client].Money  = gCvarList.ACCOUNT_CONNECT.IntValue;
-        }
-    } 
+        return false;
+    }
+    
+    /// Remove profile, so it never goes to the other player
+    gServerData.Pending.Remove(sKey);
+    
+    // Validate that index wasn't reused by the other player
+    if (mProfile.UserID != GetClientUserId(client))
+    {
+        delete mProfile.Cart;
+        return false;
+    }
+    
+    // Validate found profile
+    if (mProfile.Found)
+    {
+        // Sets client data
+        gClientData[client].DataID          = mProfile.DataID;
+        gClientData[client].Money           = mProfile.Money;
+        gClientData[client].Level           = mProfile.Level;
+        gClientData[client].Exp             = mProfile.Exp;
+        gClientData[client].ZombieClassNext = mProfile.ZombieClassNext;
+        gClientData[client].HumanClassNext  = mProfile.HumanClassNext;
+        gClientData[client].Costume         = mProfile.Costume;
+        gClientData[client].Vision          = mProfile.Vision;
+        gClientData[client].Time            = mProfile.Time;
+        gClientData[client].Rank            = mProfile.Rank;
+        
+        // Sets client cart
+        delete gClientData[client].DefaultCart;
+        gClientData[client].DefaultCart = mProfile.Cart;
+    }
+    else
+    {
+        // Initialize request char
+        static char sRequest[HUGE_LINE_LENGTH]; 
+    
+        // Generate request
+        SQLBaseFactory__(_, sRequest, sizeof(sRequest), ColumnType_AccountID, FactoryType_Insert, client);
+        
+        // Sent a request
+        gServerData.DBI.Query(SQLBaseInsert_Callback, sRequest, SQLBaseTrack__(FactoryType_Insert, GetClientUserId(client)), DBPrio_High); 
+        
+        // Close cart
+        delete mProfile.Cart;
+    }
+    
+    // Client was loaded
+    gClientData[client].Loaded = true;
+    
+    // Remember the stored cart
+    delete gClientData[client].StoredCart;
+    gClientData[client].StoredCart = (gClientData[client].DefaultCart != null) ? gClientData[client].DefaultCart.Clone() : new ArrayList();
+    return true;
 }
- 
+
 /**
- * SQL: UPDATE
- * @brief Callback for receiving asynchronous database query results.
+ * @brief Removes the pending profile of the client.
  *
- * @param hDatabase         Parent object of the handle.
- * @param hResult           Handle to the child object.
- * @param sError            Error string if there was an error.
- * @param client            Data passed in via the original threaded invocation.
+ * @param client            The client index.
  **/
-public void SQLBaseUpdate_Callback(Database hDatabase, DBResultSet hResult, char[] sError, int client)
+void SQLBaseDiscard__(int client)
 {
-    // If invalid query handle, then log error
-    if (hDatabase == null || hResult == null || hasLength(sError))
+    // If profile doesn't exist, then stop
+    static char sKey[SMALL_LINE_LENGTH]; ProfileData mProfile;
+    IntToString(gClientData[client].AccountID, sKey, sizeof(sKey));
+    if (gServerData.Pending == null || !gServerData.Pending.GetArray(sKey, mProfile, sizeof(mProfile)))
     {
-        // Unexpected error, log it
-        LogEvent(false, LogType_Error, LOG_CORE_EVENTS, LogModule_Database, "Query", "%s", sError);
+        return;
+    }
+    
+    // Validate owner of the profile
+    if (mProfile.UserID == GetClientUserId(client))
+    {
+        // Close cart
+        delete mProfile.Cart;
+        
+        // Remove profile
+        gServerData.Pending.Remove(sKey);
     }
 }
 
-/*
- * Stocks database API.
- */
- 
 /**
  * @brief Function for building any SQL request.
  *
@@ -962,6 +3431,60 @@ void SQLBaseFactory__(bool MySQL = false, char[] sRequest, int iMaxLen, ColumnTy
             LogEvent(true, LogType_Normal, LOG_CORE_EVENTS, LogModule_Database, "Query", "Table \"%s\" was dumped. \"%s\"", DATABASE_MAIN, sRequest);
         }
         
+        case FactoryType_Meta :
+        {
+            // Gets step index
+            switch (client)
+            {
+                case 0 :
+                {
+                    /// Format request
+                    FormatEx(sRequest, iMaxLen, "CREATE TABLE IF NOT EXISTS `%s` ", DATABASE_META);
+                    StrCat(sRequest, iMaxLen, 
+                    MySQL ? 
+                      "(`name` varchar(32) NOT NULL, \
+                        `value` varchar(64) NOT NULL DEFAULT '', \
+                        PRIMARY KEY (`name`));"
+                    :
+                      "(`name` TEXT PRIMARY KEY NOT NULL, \
+                        `value` TEXT NOT NULL DEFAULT '');");
+                }
+                
+                case 1 :
+                {
+                    /// Format request
+                    FormatEx(sRequest, iMaxLen, "SELECT `value` FROM `%s` WHERE `name` = 'schema';", DATABASE_META);
+                }
+                
+                case 2 :
+                {
+                    /// Format request
+                    FormatEx(sRequest, iMaxLen, "REPLACE INTO `%s` (`name`, `value`) VALUES ('schema', '%s');", DATABASE_META, sData);
+                    
+                    // Log fingerprint info
+                    LogEvent(true, LogType_Normal, LOG_CORE_EVENTS, LogModule_Database, "Query", "Schema fingerprint \"%s\" was stored. \"%s\"", sData, sRequest);
+                }
+            }
+        }
+        
+        case FactoryType_Top :
+        {
+            /// Format request
+            switch (nColumn)
+            {
+                case ColumnType_Level : FormatEx(sRequest, iMaxLen, "SELECT `account_id`, `level` FROM `%s` ORDER BY `level` DESC, `exp` DESC LIMIT %d;", DATABASE_MAIN, DATABASE_TOP_COUNT);
+                case ColumnType_Exp :   FormatEx(sRequest, iMaxLen, "SELECT `account_id`, `exp` FROM `%s` ORDER BY `exp` DESC LIMIT %d;", DATABASE_MAIN, DATABASE_TOP_COUNT);
+                case ColumnType_Money : FormatEx(sRequest, iMaxLen, "SELECT `account_id`, `money` FROM `%s` ORDER BY `money` DESC LIMIT %d;", DATABASE_MAIN, DATABASE_TOP_COUNT);
+                default :               FormatEx(sRequest, iMaxLen, "SELECT COUNT(*) FROM `%s`;", DATABASE_MAIN);
+            }
+        }
+        
+        case FactoryType_Rank :
+        {
+            /// Format request (Rank is ordered by level, then by experience)
+            FormatEx(sRequest, iMaxLen, "SELECT a.`account_id`, (SELECT COUNT(*) FROM `%s` b WHERE b.`level` > a.`level` OR (b.`level` = a.`level` AND b.`exp` > a.`exp`)) + 1 FROM `%s` a WHERE a.`account_id` IN (%s);", DATABASE_MAIN, DATABASE_MAIN, sData);
+        }
+        
         case FactoryType_Keys :
         {
              /// Format request
@@ -1134,6 +3657,16 @@ void SQLBaseFactory__(bool MySQL = false, char[] sRequest, int iMaxLen, ColumnTy
                 case ColumnType_Default :
                 {
                     StrCat(sRequest, iMaxLen, "*");
+                    
+                    /// Select rows of all listed accounts
+                    if (hasLength(sData))
+                    {
+                        Format(sRequest, iMaxLen, "%s FROM `%s` WHERE `account_id` IN (%s);", sRequest, DATABASE_MAIN, sData);
+                        
+                        // Log database selection info
+                        LogEvent(true, LogType_Normal, LOG_CORE_EVENTS, LogModule_Database, "Query", "Players were found. \"%s\"", sRequest);
+                        return;
+                    }
                 
                     // Log database updation info
                     LogEvent(true, LogType_Normal, LOG_CORE_EVENTS, LogModule_Database, "Query", "Player \"%N\" was found. \"%s\"", client, sRequest);
@@ -1182,6 +3715,14 @@ void SQLBaseFactory__(bool MySQL = false, char[] sRequest, int iMaxLen, ColumnTy
                 /* Child table */
                 case ColumnType_Weapon :
                 {
+                    /// Select weapons of all listed accounts
+                    if (hasLength(sData))
+                    {
+                        Format(sRequest, iMaxLen, "%s`%s`.`account_id`, `%s`.`weapon` FROM `%s` INNER JOIN `%s` ON `%s`.`client_id` = `%s`.`id` WHERE `%s`.`account_id` IN (%s);", 
+                        sRequest, DATABASE_MAIN, DATABASE_CHILD, DATABASE_CHILD, DATABASE_MAIN, DATABASE_CHILD, DATABASE_MAIN, DATABASE_MAIN, sData);
+                        return;
+                    }
+                    
                     StrCat(sRequest, iMaxLen, "`weapon`"); /// If client wouldn't has the id, it will not throw errors
                     Format(sRequest, iMaxLen, "%s FROM `%s` WHERE `client_id`= %d", sRequest, DATABASE_CHILD, gClientData[client].DataID);
                     return;
@@ -1202,82 +3743,81 @@ void SQLBaseFactory__(bool MySQL = false, char[] sRequest, int iMaxLen, ColumnTy
         
         case FactoryType_Update :
         {
-            static char sBuffer[3][SMALL_LINE_LENGTH];
+            static char sBuffer[SMALL_LINE_LENGTH];
         
             /// Format request
             FormatEx(sRequest, iMaxLen, "UPDATE `%s` SET", DATABASE_MAIN);    
-            switch (nColumn)
+            
+            /// Convert Steam_Auth2 column to a AccountID column
+            if (nColumn == ColumnType_AccountID)
             {
-                case ColumnType_Default :
-                {
-                    ClassGetName(gClientData[client].ZombieClassNext, sBuffer[0], sizeof(sBuffer[]));
-                    ClassGetName(gClientData[client].HumanClassNext, sBuffer[1], sizeof(sBuffer[]));
-                    CostumesGetName(gClientData[client].Costume, sBuffer[2], sizeof(sBuffer[]));
-
-                    Format(sRequest, iMaxLen, "%s `money` = %d, \
-                                                  `level` = %d, \
-                                                  `exp` = %d, \
-                                                  `zombie` = '%s', \
-                                                  `human` = '%s', \
-                                                  `skin` = '%s', \
-                                                  `vision` = %d, \
-                                                  `time` = %d",
-                    sRequest, gClientData[client].Money, gClientData[client].Level, gClientData[client].Exp, sBuffer[0], sBuffer[1], sBuffer[2], gClientData[client].Vision, GetTime());
-
-                    // Log database updation info
-                    LogEvent(true, LogType_Normal, LOG_CORE_EVENTS, LogModule_Database, "Query", "Player \"%N\" was stored. \"%s\"", client, sRequest); 
-                }
-                
-                case ColumnType_AccountID :
-                {
-                    Format(sRequest, iMaxLen, "%s `account_id` = (SELECT CAST(SUBSTR(`steam_id`, 11) AS UNSIGNED) * 2 + CAST(SUBSTR(`steam_id`, 9, 1) AS UNSIGNED));", sRequest);
-                    return;
-                }
-                
-                case ColumnType_Money :
-                {
-                    Format(sRequest, iMaxLen, "%s `money` = %d", sRequest, gClientData[client].Money);
-                }
-                
-                case ColumnType_Level :
-                {
-                    Format(sRequest, iMaxLen, "%s `level` = %d", sRequest, gClientData[client].Level);
-                }
-                
-                case ColumnType_Exp :
+                Format(sRequest, iMaxLen, "%s `account_id` = (SELECT CAST(SUBSTR(`steam_id`, 11) AS UNSIGNED) * 2 + CAST(SUBSTR(`steam_id`, 9, 1) AS UNSIGNED));", sRequest);
+                return;
+            }
+            
+            // Gets changed columns
+            int iBits = (nColumn == ColumnType_Default) ? gClientData[client].DataBits : DATABASE_BIT(nColumn); int iCount;
+            
+            // i = column index
+            for (int i = view_as<int>(ColumnType_Money); i <= view_as<int>(ColumnType_Time); i++)
+            {
+                // Validate column
+                if (!(iBits & DATABASE_BIT(i)))
                 {
-                    Format(sRequest, iMaxLen, "%s `exp` = %d", sRequest, gClientData[client].Exp);
+                    continue;
                 }
                 
-                case ColumnType_Zombie :
-                {
-                    ClassGetName(gClientData[client].ZombieClassNext, sBuffer[0], sizeof(sBuffer[]));
-         
-                    Format(sRequest, iMaxLen, "%s `zombie` = '%s'", sRequest, sBuffer[0]);
-                }
+                // Separate columns
+                if (iCount++) StrCat(sRequest, iMaxLen, ",");
                 
-                case ColumnType_Human :
+                // Sets column data
+                switch (view_as<ColumnType>(i))
                 {
-                    ClassGetName(gClientData[client].HumanClassNext, sBuffer[1], sizeof(sBuffer[]));
-         
-                    Format(sRequest, iMaxLen, "%s `human` = '%s'", sRequest, sBuffer[1]);
-                }
-
-                case ColumnType_Costume :
-                {
-                    CostumesGetName(gClientData[client].Costume, sBuffer[2], sizeof(sBuffer[]));
+                    case ColumnType_Money :
+                    {
+                        Format(sRequest, iMaxLen, "%s `money` = %d", sRequest, gClientData[client].Money);
+                    }
                     
-                    Format(sRequest, iMaxLen, "%s `skin` = '%s'", sRequest, sBuffer[2]);
-                }
-                
-                case ColumnType_Vision :
-                {
-                    Format(sRequest, iMaxLen, "%s `vision` = %d", sRequest, gClientData[client].Vision);
-                }
-
-                case ColumnType_Time :
-                {
-                    Format(sRequest, iMaxLen, "%s `time` = %d", sRequest, GetTime()); /// Gets system time as a unix timestamp
+                    case ColumnType_Level :
+                    {
+                        Format(sRequest, iMaxLen, "%s `level` = %d", sRequest, gClientData[client].Level);
+                    }
+                    
+                    case ColumnType_Exp :
+                    {
+                        Format(sRequest, iMaxLen, "%s `exp` = %d", sRequest, gClientData[client].Exp);
+                    }
+                    
+                    case ColumnType_Zombie :
+                    {
+                        ClassGetName(gClientData[client].ZombieClassNext, sBuffer, sizeof(sBuffer));
+             
+                        Format(sRequest, iMaxLen, "%s `zombie` = '%s'", sRequest, sBuffer);
+                    }
+                    
+                    case ColumnType_Human :
+                    {
+                        ClassGetName(gClientData[client].HumanClassNext, sBuffer, sizeof(sBuffer));
+             
+                        Format(sRequest, iMaxLen, "%s `human` = '%s'", sRequest, sBuffer);
+                    }
+    
+                    case ColumnType_Costume :
+                    {
+                        CostumesGetName(gClientData[client].Costume, sBuffer, sizeof(sBuffer));
+                        
+                        Format(sRequest, iMaxLen, "%s `skin` = '%s'", sRequest, sBuffer);
+                    }
+                    
+                    case ColumnType_Vision :
+                    {
+                        Format(sRequest, iMaxLen, "%s `vision` = %d", sRequest, gClientData[client].Vision);
+                    }
+    
+                    case ColumnType_Time :
+                    {
+                        Format(sRequest, iMaxLen, "%s `time` = %d", sRequest, GetTime()); /// Gets system time as a unix timestamp
+                    }
                 }
             }
             
@@ -1290,6 +3830,12 @@ void SQLBaseFactory__(bool MySQL = false, char[] sRequest, int iMaxLen, ColumnTy
             {
                 Format(sRequest, iMaxLen, "%s WHERE `id` = %d;", sRequest, gClientData[client].DataID);
             }
+            
+            // Log database updation info
+            if (nColumn == ColumnType_Default)
+            {
+                LogEvent(true, LogType_Normal, LOG_CORE_EVENTS, LogModule_Database, "Query", "Player \"%N\" was stored. \"%s\"", client, sRequest); 
+            }
         }
         
         case FactoryType_Insert :
@@ -1321,5 +3867,38 @@ void SQLBaseFactory__(bool MySQL = false, char[] sRequest, int iMaxLen, ColumnTy
             /// Format request
             FormatEx(sRequest, iMaxLen, "DELETE FROM `%s` WHERE `client_id` = %d AND `weapon` = '%s';", DATABASE_CHILD, gClientData[client].DataID, sData);
         }
+        
+        case FactoryType_Replace :
+        {
+            /// Format row
+            if (client)
+            {
+                static char sBuffer[3][SMALL_LINE_LENGTH];
+                
+                ClassGetName(gClientData[client].ZombieClassNext, sBuffer[0], sizeof(sBuffer[]));
+                ClassGetName(gClientData[client].HumanClassNext, sBuffer[1], sizeof(sBuffer[]));
+                CostumesGetName(gClientData[client].Costume, sBuffer[2], sizeof(sBuffer[]));
+                
+                FormatEx(sRequest, iMaxLen, "(%d, %d, %d, %d, %d, '%s', '%s', '%s', %d, %d)", 
+                gClientData[client].DataID, gClientData[client].AccountID, gClientData[client].Money, gClientData[client].Level, gClientData[client].Exp, sBuffer[0], sBuffer[1], sBuffer[2], gClientData[client].Vision, GetTime());
+                return;
+            }
+            
+            /// Format request (The id is kept, so rows of the child table stay valid)
+            FormatEx(sRequest, iMaxLen, "%s `%s` (`id`, `account_id`, `money`, `level`, `exp`, `zombie`, `human`, `skin`, `vision`, `time`) VALUES %s", MySQL ? "INSERT INTO" : "INSERT OR REPLACE INTO", DATABASE_MAIN, sData);
+            StrCat(sRequest, iMaxLen, 
+            MySQL ? 
+              " ON DUPLICATE KEY UPDATE \
+                `money` = VALUES(`money`), \
+                `level` = VALUES(`level`), \
+                `exp` = VALUES(`exp`), \
+                `zombie` = VALUES(`zombie`), \
+                `human` = VALUES(`human`), \
+                `skin` = VALUES(`skin`), \
+                `vision` = VALUES(`vision`), \
+                `time` = VALUES(`time`);"
+            :
+              ";");
+        }
     }
 }
\ No newline at end of file
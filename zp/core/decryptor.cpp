@@ -25,6 +25,103 @@
  * ============================================================================
  **/
 
+/**
+ * @section Studio model header (studiohdr_t) offsets.
+ **/
+#define STUDIO_ID                   0x54534449 /** "IDST" */
+#define STUDIO_OFFSET_LENGTH        76         /** int length */
+#define STUDIO_OFFSET_TEXTURES      204        /** int numtextures, textureindex, numcdtextures, cdtextureindex */
+#define STUDIO_TEXTURE_SIZE         16         /** Size of mstudiotexture_t in cells */
+#define STUDIO_TEXTURE_BLOCK        16         /** Amount of textures per block read */
+#define STUDIO_TEXTURE_MAX          1024       /** Sanity limit for the texture tables */
+/**
+ * @endsection
+ **/
+
+/**
+ * @section Asset manifest.
+ **/
+#define DECRYPT_MANIFEST_PATH       "data/zombieplague_assets.dat"
+#define DECRYPT_MANIFEST_ID         0x4D41505A /** "ZPAM" */
+#define DECRYPT_MANIFEST_VERSION    2
+#define MANIFEST_MATERIALS          (1<<0)     /** Materials and textures are parsed */
+#define MANIFEST_SOUNDS             (1<<1)     /** Sounds are parsed */
+/**
+ * @endsection
+ **/
+
+/**
+ * @section Manifest entry data.
+ **/
+enum /*ManifestData*/
+{
+    Manifest_Size,                /** Source file size */
+    Manifest_Time,                /** Source file last change time */
+    Manifest_Flags,               /** Parsed resource types */
+    Manifest_Materials,           /** Array of material paths, textures are resolved on each map */
+    Manifest_Sounds,              /** Array of sound paths */
+
+    Manifest_Length
+};
+/**
+ * @endsection
+ **/
+
+/**
+ * @brief Decryptor module init function.
+ **/
+void DecryptOnInit(/*void*/)
+{
+    // Create manifest map
+    gServerData.Manifest = new StringMap();
+    
+    // Create map caches
+    gServerData.MaterialCache = new StringMap();
+    gServerData.TextureCache = new StringMap();
+    
+    // Load manifest from file
+    DecryptLoadManifest();
+}
+
+/**
+ * @brief Decryptor module purge function.
+ **/
+void DecryptOnPurge(/*void*/)
+{
+    // Store manifest changes
+    DecryptSaveManifest();
+    
+    // Clear map caches
+    DecryptClearCache();
+}
+
+/**
+ * @brief Decryptor module unload function.
+ **/
+void DecryptOnUnload(/*void*/)
+{
+    // Store manifest changes
+    DecryptSaveManifest();
+    
+    // Clear manifest entries
+    DecryptClearManifest();
+    delete gServerData.Manifest;
+    
+    // Clear map caches
+    DecryptClearCache();
+    delete gServerData.MaterialCache;
+    delete gServerData.TextureCache;
+}
+
+/**
+ * @brief Creates commands for decryptor module.
+ **/
+void DecryptOnCommandInit(/*void*/)
+{
+    // Hook commands
+    RegAdminCmd("zp_decrypt_validate", DecryptOnCommandCatched, ADMFLAG_CONFIG, "Compares the materials parsed from a model header with its legacy materials file. Usage: zp_decrypt_validate <model path>");
+}
+
 /**
  * @brief Precache models and return model index.
  *
@@ -200,124 +297,85 @@ void DecryptPrecacheResources(char[] sModel)
  **/
 bool DecryptPrecacheSounds(char[] sModel)
 {
-    // Finds the first occurrence of a character in a string
-    int iFormat = FindCharInString(sModel, '.', true);
-    
-    // If model path is don't have format, then log, and stop
-    if (iFormat == -1)
+    // Gets manifest entry
+    any iData[Manifest_Length];
+    if (DecryptGetManifest(sModel, MANIFEST_SOUNDS, iData))
     {
-        LogEvent(false, LogType_Fatal, LOG_CORE_EVENTS, LogModule_Decrypt, "Config Validation", "Missing file format: %s", sModel);
-        return false;
+        // Precache resources from the manifest
+        DecryptPrecacheManifest(sModel, iData, MANIFEST_SOUNDS);
+        return true;
     }
     
-    // Extract value string
-    static char sPath[PLATFORM_LINE_LENGTH];
-    StrExtract(sPath, sModel, 0, iFormat);
+    // Opens the file
+    File hFile = OpenFile(sModel, "rb");
 
-    // Concatenates one string onto another
-    StrCat(sPath, sizeof(sPath), "_sounds.txt");
+    // If doesn't exist stop
+    if (hFile == null)
+    {
+        LogEvent(false, LogType_Fatal, LOG_CORE_EVENTS, LogModule_Decrypt, "Config Validation", "Error opening file: \"%s\"", sModel);
+        return false;
+    }
     
-    // Validate if a file exists
-    bool bExists = FileExists(sPath);
+    // Initialize variables
+    static char sPath[PLATFORM_LINE_LENGTH]; int iChar; ///int iNumSeq;
+    ArrayList hSounds = iData[Manifest_Sounds];
+
+    // Find the total sequence amount
+    /*
+        hFile.Seek(180, SEEK_SET);
+        hFile.ReadInt32(iNumSeq);
+    */
     
-    // Opens/Create the file
-    File hBase = OpenFile(sPath, "at+");
-
-    // If file doesn't exist, then write it
-    if (!bExists)
+    do /// Reads a single binary char
     {
-        // Opens the file
-        File hFile = OpenFile(sModel, "rb");
+        hFile.Seek(2, SEEK_CUR);
+        hFile.ReadInt8(iChar);
+    } 
+    while (iChar == 0);
 
-        // If doesn't exist stop
-        if (hFile == null)
-        {
-            DeleteFile(sPath);
-            LogEvent(false, LogType_Fatal, LOG_CORE_EVENTS, LogModule_Decrypt, "Config Validation", "Error opening file: \"%s\"", sModel);
-            return false;
-        }
-        
-        // Initialize variables
-        int iChar; ///int iNumSeq;
-
-        // Find the total sequence amount
-        /*
-            hFile.Seek(180, SEEK_SET);
-            hFile.ReadInt32(iNumSeq);
-        */
-        
-        do /// Reads a single binary char
-        {
-            hFile.Seek(2, SEEK_CUR);
-            hFile.ReadInt8(iChar);
-        } 
-        while (iChar == 0);
+    // Shift the cursor a bit
+    hFile.Seek(1, SEEK_CUR);
 
-        // Shift the cursor a bit
-        hFile.Seek(1, SEEK_CUR);
+    do /// Reads a single binary char
+    {
+        hFile.Seek(2, SEEK_CUR);
+        hFile.ReadInt8(iChar);
+    } 
+    while (iChar);
 
-        do /// Reads a single binary char
-        {
-            hFile.Seek(2, SEEK_CUR);
-            hFile.ReadInt8(iChar);
-        } 
-        while (iChar);
+    // Loop throught the binary
+    while (!hFile.EndOfFile())
+    {
+        // Reads a UTF8 or ANSI string from a file
+        hFile.ReadString(sPath, sizeof(sPath));
+        
+        // Finds the first occurrence of a character in a string
+        int iFormat = FindCharInString(sPath, '.', true);
 
-        // Loop throught the binary
-        while (!hFile.EndOfFile())
+        // Validate format
+        if (iFormat != -1) 
         {
-            // Reads a UTF8 or ANSI string from a file
-            hFile.ReadString(sPath, sizeof(sPath));
-            
-            // Finds the first occurrence of a character in a string
-            iFormat = FindCharInString(sPath, '.', true);
-
-            // Validate format
-            if (iFormat != -1) 
+            // Validate sound format
+            if (!strcmp(sPath[iFormat], ".mp3", false) || !strcmp(sPath[iFormat], ".wav", false))
             {
-                // Validate sound format
-                if (!strcmp(sPath[iFormat], ".mp3", false) || !strcmp(sPath[iFormat], ".wav", false))
-                {
-                    // Format full path to file
-                    Format(sPath, sizeof(sPath), "sound/%s", sPath);
-                    
-                    // Store into the base
-                    hBase.WriteLine(sPath);
-                    
-                    // Add file to download table
-                    SoundsPrecacheQuirk(sPath);
-                }
+                // Format full path to file
+                Format(sPath, sizeof(sPath), "sound/%s", sPath);
+                
+                // Store into the manifest
+                hSounds.PushString(sPath);
+                
+                // Add file to download table
+                SoundsPrecacheQuirk(sPath);
             }
         }
-
-        // Close file
-        delete hFile; 
-        ///return true;
     }
-    else
-    {
-        // Read lines in the file
-        while (hBase.ReadLine(sPath, sizeof(sPath)))
-        {
-            // Cut out comments at the end of a line
-            SplitString(sPath, "//", sPath, sizeof(sPath));
-            
-            // Trim off whitespace
-            TrimString(sPath);
 
-            // If line is empty, then stop
-            if (!hasLength(sPath))
-            {
-                continue;
-            }
-            
-            // Add file to download table
-            SoundsPrecacheQuirk(sPath);
-        }
-    }
+    // Update the manifest
+    iData[Manifest_Flags] |= MANIFEST_SOUNDS;
+    DecryptSetManifest(sModel, iData);
     
     // Close file
-    delete hBase;
+    delete hFile; 
     return true;
 }
 
@@ -329,211 +387,53 @@ bool DecryptPrecacheSounds(char[] sModel)
  **/
 bool DecryptPrecacheMaterials(char[] sModel)
 {
-    // Finds the first occurrence of a character in a string
-    int iFormat = FindCharInString(sModel, '.', true);
+    // Gets manifest entry
+    any iData[Manifest_Length];
+    if (DecryptGetManifest(sModel, MANIFEST_MATERIALS, iData))
+    {
+        // Precache resources from the manifest
+        DecryptPrecacheManifest(sModel, iData, MANIFEST_MATERIALS);
+        return true;
+    }
     
-    // If model path is don't have format, then log, and stop
-    if (iFormat == -1)
+    // Opens the file
+    File hFile = OpenFile(sModel, "rb");
+
+    // If doesn't exist stop
+    if (hFile == null)
     {
-        LogEvent(false, LogType_Fatal, LOG_CORE_EVENTS, LogModule_Decrypt, "Config Validation", "Missing file format: %s", sModel);
+        LogEvent(false, LogType_Fatal, LOG_CORE_EVENTS, LogModule_Decrypt, "Config Validation", "Error opening file: \"%s\"", sModel);
         return false;
     }
     
-    // Extract value string
-    static char sPath[PLATFORM_LINE_LENGTH];
-    StrExtract(sPath, sModel, 0, iFormat);
-
-    // Concatenates one string onto another
-    StrCat(sPath, sizeof(sPath), "_materials.txt");
-
-    // Validate if a file exists
-    bool bExists = FileExists(sPath);
+    // Initialize a material list array
+    ArrayList hList = new ArrayList(PLATFORM_LINE_LENGTH);
     
-    // Opens/Create the file
-    File hBase = OpenFile(sPath, "at+");
-
-    // If file doesn't exist, then write it
-    if (!bExists)
+    // Reads materials from the model header
+    if (!DecryptReadStudioMaterials(hFile, hList))
     {
-        // Opens the file
-        File hFile = OpenFile(sModel, "rb");
-
-        // If doesn't exist stop
-        if (hFile == null)
-        {
-            DeleteFile(sPath);
-            LogEvent(false, LogType_Fatal, LOG_CORE_EVENTS, LogModule_Decrypt, "Config Validation", "Error opening file: \"%s\"", sModel);
-            return false;
-        }
-        
-        // Initialize variables
-        static char sMaterial[PLATFORM_LINE_LENGTH]; int iNumMat; int iChar;
-
-        // Find the total materials amount
-        hFile.Seek(204, SEEK_SET);
-        hFile.ReadInt32(iNumMat);
-        hFile.Seek(0, SEEK_END);
-        
-        do /// Reads a single binary char
-        {
-            hFile.Seek(-2, SEEK_CUR);
-            hFile.ReadInt8(iChar);
-        } 
-        while (iChar == 0);
-
-        // Shift the cursor a bit
-        hFile.Seek(-1, SEEK_CUR);
-
-        do /// Reads a single binary char
-        {
-            hFile.Seek(-2, SEEK_CUR);
-            hFile.ReadInt8(iChar);
-        } 
-        while (iChar);
-
-        // Reads a UTF8 or ANSI string from a file
-        int iPosIndex = hFile.Position;
-        hFile.ReadString(sMaterial, sizeof(sMaterial));
-        hFile.Seek(iPosIndex, SEEK_SET);
-        hFile.Seek(-1, SEEK_CUR);
-        
-        // Initialize a material list array
-        ArrayList hList = new ArrayList(SMALL_LINE_LENGTH);
-
-        // Reverse loop throught the binary
-        while (hFile.Position > 1 && hList.Length < iNumMat)
-        {
-            do /// Reads a single binary char
-            {
-                hFile.Seek(-2, SEEK_CUR);
-                hFile.ReadInt8(iChar);
-            } 
-            while (iChar);
-
-            // Reads a UTF8 or ANSI string from a file
-            iPosIndex = hFile.Position;
-            hFile.ReadString(sPath, sizeof(sPath));
-            hFile.Seek(iPosIndex, SEEK_SET);
-            hFile.Seek(-1, SEEK_CUR);
-
-            // Validate size
-            if (!hasLength(sPath))
-            {
-                continue;
-            }
-
-            // Finds the first occurrence of a character in a string
-            iFormat = FindCharInString(sPath, '\\', true);
-
-            // Validate no format
-            if (iFormat != -1)
-            {
-                // Format full path to directory
-                Format(sPath, sizeof(sPath), "materials\\%s", sPath);
-        
-                // Opens the directory
-                DirectoryListing hDirectory = OpenDirectory(sPath);
-                
-                // If doesn't exist stop
-                if (hDirectory == null)
-                {
-                    LogEvent(false, LogType_Error, LOG_CORE_EVENTS, LogModule_Decrypt, "Config Validation", "Error opening folder: \"%s\"", sPath);
-                    continue;
-                }
-
-                // Initialize variables
-                static char sFile[PLATFORM_LINE_LENGTH]; FileType hType;
-                
-                // Search files in the directory
-                while (hDirectory.GetNext(sFile, sizeof(sFile), hType)) 
-                {
-                    // Validate file type
-                    if (hType == FileType_File) 
-                    {
-                        // Finds the first occurrence of a character in a string
-                        iFormat = FindCharInString(sFile, '.', true);
-                
-                        // Validate format
-                        if (iFormat != -1) 
-                        {
-                            // Validate material format
-                            if (!strcmp(sFile[iFormat], ".vmt", false))
-                            {
-                                // Validate unique material
-                                if (hList.FindString(sFile) == -1)
-                                {
-                                    // Push data into array
-                                    hList.PushString(sFile);
-                                }
-                                
-                                // Format full path to file
-                                Format(sFile, sizeof(sFile), "%s%s", sPath, sFile);
-                                
-                                // Store into the base
-                                hBase.WriteLine(sFile);
-
-                                // Precache model textures
-                                DecryptPrecacheTextures(sModel, sFile);
-                            }
-                        }
-                    }
-                }
-
-                // Close directory
-                delete hDirectory;
-            }
-            else
-            {
-                // Concatenates one string onto another
-                StrCat(sPath, sizeof(sPath), ".vmt");
-        
-                // Validate unique key
-                if (hList.FindString(sPath) == -1)
-                {
-                    // Push data into array
-                    hList.PushString(sPath);
-                }
-                
-                // Format full path to file
-                Format(sPath, sizeof(sPath), "materials\\%s%s", sMaterial, sPath);
-                
-                // Store into the base
-                hBase.WriteLine(sPath);
-                
-                // Precache model textures
-                DecryptPrecacheTextures(sModel, sPath);
-            }
-        }
-
-        // Close file
-        delete hFile;
-        delete hList;
-        ///return true;
+        LogEvent(false, LogType_Error, LOG_CORE_EVENTS, LogModule_Decrypt, "Config Validation", "Invalid studio header in file: \"%s\"", sModel);
     }
-    else
+    
+    // i = material index
+    static char sPath[PLATFORM_LINE_LENGTH];
+    int iSize = hList.Length;
+    for (int i = 0; i < iSize; i++)
     {
-        // Read lines in the file
-        while (hBase.ReadLine(sPath, sizeof(sPath)))
-        {
-            // Cut out comments at the end of a line
-            SplitString(sPath, "//", sPath, sizeof(sPath));
-            
-            // Trim off whitespace
-            TrimString(sPath);
-
-            // If line is empty, then stop
-            if (!hasLength(sPath))
-            {
-                continue;
-            }
-            
-            // Precache model textures
-            DecryptPrecacheTextures(sModel, sPath);
-        }
+        // Gets material path
+        hList.GetString(i, sPath, sizeof(sPath));
+        
+        // Precache model textures
+        DecryptPrecacheTextures(sModel, sPath, iData[Manifest_Materials]);
     }
     
+    // Update the manifest
+    iData[Manifest_Flags] |= MANIFEST_MATERIALS;
+    DecryptSetManifest(sModel, iData);
+
     // Close file
-    delete hBase;
+    delete hFile;
+    delete hList;
     return true;
 }
 
@@ -545,16 +445,6 @@ bool DecryptPrecacheMaterials(char[] sModel)
  **/
 bool DecryptPrecacheEffects(char[] sModel)
 {
-    // Finds the first occurrence of a character in a string
-    int iFormat = FindCharInString(sModel, '.', true);
-    
-    // If model path is don't have format, then log, and stop
-    if (iFormat == -1)
-    {
-        LogEvent(false, LogType_Fatal, LOG_CORE_EVENTS, LogModule_Decrypt, "Config Validation", "Missing file format: %s", sModel);
-        return false;
-    }
-
     /// @link https://github.com/VSES/SourceEngine2007/blob/master/src_main/movieobjects/dmeparticlesystemdefinition.cpp
     /*static char sParticleFuncTypes[48][SMALL_LINE_LENGTH] =
     {
@@ -568,108 +458,75 @@ bool DecryptPrecacheEffects(char[] sModel)
     // Add file to download table
     AddFileToDownloadsTable(sModel);
 
-    // Extract value string
-    static char sPath[PLATFORM_LINE_LENGTH];
-    StrExtract(sPath, sModel, 0, iFormat);
-
-    // Concatenates one string onto another
-    StrCat(sPath, sizeof(sPath), "_particles.txt");
-    
-    // Validate if a file exists
-    bool bExists = FileExists(sPath);
+    // Gets manifest entry
+    any iData[Manifest_Length];
+    if (DecryptGetManifest(sModel, MANIFEST_MATERIALS, iData))
+    {
+        // Precache resources from the manifest
+        DecryptPrecacheManifest(sModel, iData, MANIFEST_MATERIALS);
+        return true;
+    }
     
-    // Opens/Create the file
-    File hBase = OpenFile(sPath, "at+");
+    // Opens the file
+    File hFile = OpenFile(sModel, "rb");
 
-    // If file doesn't exist, then write it
-    if (!bExists)
+    // If doesn't exist stop
+    if (hFile == null)
     {
-        // Opens the file
-        File hFile = OpenFile(sModel, "rb");
-
-        // If doesn't exist stop
-        if (hFile == null)
-        {
-            DeleteFile(sPath);
-            LogEvent(false, LogType_Fatal, LOG_CORE_EVENTS, LogModule_Decrypt, "Config Validation", "Error opening file: \"%s\"", sModel);
-            return false;
-        }
-
-        // Initialize variables
-        int iChar; ///int iNumMat;
+        LogEvent(false, LogType_Fatal, LOG_CORE_EVENTS, LogModule_Decrypt, "Config Validation", "Error opening file: \"%s\"", sModel);
+        return false;
+    }
 
-        do /// Reads a single binary char
-        {
-            hFile.Seek(2, SEEK_CUR);
-            hFile.ReadInt8(iChar);
-        } 
-        while (iChar == 0);
+    // Initialize variables
+    static char sPath[PLATFORM_LINE_LENGTH]; int iChar; ///int iNumMat;
 
-        // Shift the cursor a bit
-        hFile.Seek(1, SEEK_CUR);
+    do /// Reads a single binary char
+    {
+        hFile.Seek(2, SEEK_CUR);
+        hFile.ReadInt8(iChar);
+    } 
+    while (iChar == 0);
 
-        do /// Reads a single binary char
-        {
-            hFile.Seek(2, SEEK_CUR);
-            hFile.ReadInt8(iChar);
-        } 
-        while (iChar);
+    // Shift the cursor a bit
+    hFile.Seek(1, SEEK_CUR);
 
-        // Loop throught the binary
-        while (!hFile.EndOfFile())
-        {
-            // Reads a UTF8 or ANSI string from a file
-            hFile.ReadString(sPath, sizeof(sPath));
+    do /// Reads a single binary char
+    {
+        hFile.Seek(2, SEEK_CUR);
+        hFile.ReadInt8(iChar);
+    } 
+    while (iChar);
 
-            // Finds the first occurrence of a character in a string
-            iFormat = FindCharInString(sPath, '.', true);
+    // Loop throught the binary
+    while (!hFile.EndOfFile())
+    {
+        // Reads a UTF8 or ANSI string from a file
+        hFile.ReadString(sPath, sizeof(sPath));
 
-            // Validate format
-            if (iFormat != -1)
-            {
-                // Validate material format
-                if (!strcmp(sPath[iFormat], ".vmt", false))
-                {
-                    // Format full path to file
-                    Format(sPath, sizeof(sPath), "materials\\%s", sPath);
-                    
-                    // Store into the base
-                    hBase.WriteLine(sPath);
-                    
-                    // Precache model textures
-                    DecryptPrecacheTextures(sModel, sPath);
-                }
-            }
-        }
+        // Finds the first occurrence of a character in a string
+        int iFormat = FindCharInString(sPath, '.', true);
 
-        // Close file
-        delete hFile;
-        ///return true;
-    }
-    else
-    {
-        // Read lines in the file
-        while (hBase.ReadLine(sPath, sizeof(sPath)))
+        // Validate format
+        if (iFormat != -1)
         {
-            // Cut out comments at the end of a line
-            SplitString(sPath, "//", sPath, sizeof(sPath));
-        
-            // Trim off whitespace
-            TrimString(sPath);
-
-            // If line is empty, then stop
-            if (!hasLength(sPath))
+            // Validate material format
+            if (!strcmp(sPath[iFormat], ".vmt", false))
             {
-                continue;
+                // Format full path to file
+                Format(sPath, sizeof(sPath), "materials\\%s", sPath);
+                
+                // Precache model textures
+                DecryptPrecacheTextures(sModel, sPath, iData[Manifest_Materials]);
             }
-
-            // Precache model textures
-            DecryptPrecacheTextures(sModel, sPath);
         }
     }
+
+    // Update the manifest
+    iData[Manifest_Flags] |= MANIFEST_MATERIALS;
+    DecryptSetManifest(sModel, iData);
     
     // Close file
-    delete hBase;
+    delete hFile;
     return true;
 }
 
@@ -678,15 +535,30 @@ bool DecryptPrecacheEffects(char[] sModel)
  *
  * @param sModel            The model name.
  * @param sPath             The texture path.
- * @param bDecal            (Optional) If true, the texture will be precached like a decal.
+ * @param hMaterials        (Optional) The array to store material paths in.
  * @return                  True if was precached, false otherwise.
  **/
-bool DecryptPrecacheTextures(char[] sModel, char[] sPath)
+bool DecryptPrecacheTextures(char[] sModel, char[] sPath, ArrayList hMaterials = null)
 {
     // Finds the first occurrence of a character in a string
     int iSlash = max(FindCharInString(sModel, '/', true), FindCharInString(sModel, '\\', true));
     if (iSlash == -1) iSlash = 0; else iSlash++; /// For the root directory to get correct name
     
+    /// Material files can change without the model, so they are validated on each map
+    if (hMaterials != null && hMaterials.FindString(sPath) == -1)
+    {
+        hMaterials.PushString(sPath);
+    }
+    
+    // If material was processed on this map, then skip it
+    bool bLocal;
+    if (gServerData.MaterialCache.GetValue(sPath, bLocal))
+    {
+        // Update hits
+        gServerData.MaterialHits++;
+        return true;
+    }
+    
     // Dublicate value string
     static char sTexture[PLATFORM_LINE_LENGTH];
     strcopy(sTexture, sizeof(sTexture), sPath);
@@ -697,6 +569,9 @@ bool DecryptPrecacheTextures(char[] sModel, char[] sPath)
         // Try to find file in .vpk
         if (FileExists(sTexture, true))
         {
+            // Default materials are never downloaded
+            gServerData.MaterialCache.SetValue(sPath, false);
+            
             // Return on success
             return true;
         }
@@ -712,6 +587,10 @@ bool DecryptPrecacheTextures(char[] sModel, char[] sPath)
     // Initialize variables
     static char sTypes[4][SMALL_LINE_LENGTH] = { "$baseTexture", "$bumpmap", "$lightwarptexture", "$REFRACTTINTtexture" }; bool bFound[sizeof(sTypes)]; int iShift;
     
+    // Start measuring
+    Profiler hProfiler = new Profiler();
+    hProfiler.Start();
+    
     // Opens the file
     File hFile = OpenFile(sTexture, "rt");
     
@@ -719,6 +598,7 @@ bool DecryptPrecacheTextures(char[] sModel, char[] sPath)
     if (hFile == null)
     {
         LogEvent(false, LogType_Fatal, LOG_CORE_EVENTS, LogModule_Decrypt, "Config Validation", "Error opening file: \"%s\"", sTexture);
+        delete hProfiler;
         return false;
     }
     
@@ -773,26 +653,664 @@ bool DecryptPrecacheTextures(char[] sModel, char[] sPath)
                     // Format full path to file
                     Format(sTexture, sizeof(sTexture), "materials\\%s.vtf", sTexture);
 
-                    // Validate material
-                    if (FileExists(sTexture))
-                    {
-                        // Add file to download table
-                        AddFileToDownloadsTable(sTexture);
-                    }
-                    else
-                    {
-                        // Validate non default textures
-                        if (!FileExists(sTexture, true))
-                        {
-                            LogEvent(false, LogType_Error, LOG_CORE_EVENTS, LogModule_Decrypt, "Config Validation", "Invalid texture path. File not found: \"%s\"", sTexture);
-                        }
-                   }
+                    // Add file to download table once per map
+                    DecryptPrecacheTexture(sTexture);
                 }
             }
         }
     }
 
+    // Stop measuring
+    hProfiler.Stop();
+    gServerData.MaterialTime += hProfiler.Time;
+    gServerData.MaterialParses++;
+    delete hProfiler;
+    
+    // Store material
+    gServerData.MaterialCache.SetValue(sPath, true);
+
     // Close file
     delete hFile; 
     return true;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Adds a texture to the download table once per map.
+ *
+ * @param sTexture          The texture path.
+ * @return                  True if the texture is downloaded, false if it is default or missing.
+ **/
+bool DecryptPrecacheTexture(char[] sTexture)
+{
+    // If texture was processed on this map, then skip it
+    bool bLocal;
+    if (gServerData.TextureCache.GetValue(sTexture, bLocal))
+    {
+        gServerData.TextureHits++;
+        return bLocal;
+    }
+    
+    // Validate texture
+    bLocal = FileExists(sTexture);
+    if (bLocal)
+    {
+        // Add file to download table
+        AddFileToDownloadsTable(sTexture);
+    }
+    else
+    {
+        // Validate non default textures
+        if (!FileExists(sTexture, true))
+        {
+            LogEvent(false, LogType_Error, LOG_CORE_EVENTS, LogModule_Decrypt, "Config Validation", "Invalid texture path. File not found: \"%s\"", sTexture);
+        }
+    }
+    
+    // Store texture
+    gServerData.TextureCache.SetValue(sTexture, bLocal);
+    return bLocal;
+}
+
+/**
+ * @brief Clears the material and texture caches of the current map.
+ **/
+void DecryptClearCache(/*void*/)
+{
+    // Clear maps
+    gServerData.MaterialCache.Clear();
+    gServerData.TextureCache.Clear();
+    
+    // Resets stats
+    gServerData.MaterialHits = 0;
+    gServerData.MaterialParses = 0;
+    gServerData.TextureHits = 0;
+    gServerData.MaterialTime = 0.0;
+}
+
+/**
+ * @brief Reads the materials of a studio model from its header.
+ *
+ * @note Each texture is resolved against the cdtexture directories in the same order as the engine does,
+ *       the first directory which has the material wins.
+ *
+ * @param hFile             The model file handle.
+ * @param hList             The array to push resolved material paths in.
+ * @return                  True if the header is valid, false otherwise.
+ **/
+bool DecryptReadStudioMaterials(File hFile, ArrayList hList)
+{
+    // Initialize variables
+    static int iTable[STUDIO_TEXTURE_SIZE * STUDIO_TEXTURE_BLOCK]; int iHeader[4]; int iLength;
+    
+    // Validate header id
+    hFile.Seek(0, SEEK_SET);
+    if (hFile.Read(iHeader, 1, 4) != 1 || iHeader[0] != STUDIO_ID)
+    {
+        return false;
+    }
+    
+    // Gets file length from the header
+    hFile.Seek(STUDIO_OFFSET_LENGTH, SEEK_SET);
+    hFile.ReadInt32(iLength);
+    
+    // Reads texture tables
+    hFile.Seek(STUDIO_OFFSET_TEXTURES, SEEK_SET);
+    if (hFile.Read(iHeader, 4, 4) != 4)
+    {
+        return false;
+    }
+    
+    // Validate table bounds
+    int iNumTex = iHeader[0]; int iTexIndex = iHeader[1]; int iNumDir = iHeader[2]; int iDirIndex = iHeader[3];
+    if (iNumTex < 0 || iNumTex > STUDIO_TEXTURE_MAX || iNumDir < 0 || iNumDir > STUDIO_TEXTURE_MAX || iTexIndex < 0 || iTexIndex + iNumTex * STUDIO_TEXTURE_SIZE * 4 > iLength || iDirIndex < 0 || iDirIndex + iNumDir * 4 > iLength)
+    {
+        return false;
+    }
+    
+    // Initialize name arrays
+    ArrayList hTextures = new ArrayList(PLATFORM_LINE_LENGTH);
+    ArrayList hDirectories = new ArrayList(PLATFORM_LINE_LENGTH);
+    static char sName[PLATFORM_LINE_LENGTH];
+    
+    // i = texture block index
+    for (int i = 0; i < iNumTex; i += STUDIO_TEXTURE_BLOCK)
+    {
+        // Reads the block of mstudiotexture_t
+        int iCount = min(STUDIO_TEXTURE_BLOCK, iNumTex - i);
+        hFile.Seek(iTexIndex + i * STUDIO_TEXTURE_SIZE * 4, SEEK_SET);
+        if (hFile.Read(iTable, iCount * STUDIO_TEXTURE_SIZE, 4) != iCount * STUDIO_TEXTURE_SIZE)
+        {
+            break;
+        }
+        
+        // x = texture in the block
+        for (int x = 0; x < iCount; x++)
+        {
+            // Name offset is relative to the texture itself
+            hFile.Seek(iTexIndex + (i + x) * STUDIO_TEXTURE_SIZE * 4 + iTable[x * STUDIO_TEXTURE_SIZE], SEEK_SET);
+            hFile.ReadString(sName, sizeof(sName));
+            
+            // Validate unique texture
+            if (hasLength(sName) && hTextures.FindString(sName) == -1)
+            {
+                hTextures.PushString(sName);
+            }
+        }
+    }
+    
+    // i = directory block index
+    for (int i = 0; i < iNumDir; i += sizeof(iTable))
+    {
+        // Reads the block of directory offsets
+        int iCount = min(sizeof(iTable), iNumDir - i);
+        hFile.Seek(iDirIndex + i * 4, SEEK_SET);
+        if (hFile.Read(iTable, iCount, 4) != iCount)
+        {
+            break;
+        }
+        
+        // x = directory in the block
+        for (int x = 0; x < iCount; x++)
+        {
+            // Directory offset is relative to the header
+            hFile.Seek(iTable[x], SEEK_SET);
+            hFile.ReadString(sName, sizeof(sName));
+            
+            // Validate the trailing slash
+            int iLen = strlen(sName);
+            if (iLen && sName[iLen - 1] != '\\' && sName[iLen - 1] != '/')
+            {
+                StrCat(sName, sizeof(sName), "\\");
+            }
+            
+            // Push data into array
+            hDirectories.PushString(sName);
+        }
+    }
+    
+    // Model without directories is looking in the root
+    if (!hDirectories.Length)
+    {
+        hDirectories.PushString("");
+    }
+    
+    // Initialize variables
+    static char sTexture[PLATFORM_LINE_LENGTH]; static char sDir[PLATFORM_LINE_LENGTH];
+    
+    // i = texture index
+    int iSize = hTextures.Length; int iDirs = hDirectories.Length;
+    for (int i = 0; i < iSize; i++)
+    {
+        // Gets texture name
+        hTextures.GetString(i, sTexture, sizeof(sTexture)); bool bFound;
+        
+        // x = directory index
+        for (int x = 0; x < iDirs; x++)
+        {
+            // Format full path to file
+            hDirectories.GetString(x, sDir, sizeof(sDir));
+            FormatEx(sName, sizeof(sName), "materials\\%s%s.vmt", sDir, sTexture);
+            
+            // If material exists, then stop
+            if ((bFound = (FileExists(sName) || FileExists(sName, true))))
+            {
+                break;
+            }
+        }
+        
+        // Keep the first directory for the missing ones, so they are logged on precache
+        if (!bFound)
+        {
+            hDirectories.GetString(0, sDir, sizeof(sDir));
+            FormatEx(sName, sizeof(sName), "materials\\%s%s.vmt", sDir, sTexture);
+        }
+        
+        // Validate unique material
+        if (hList.FindString(sName) == -1)
+        {
+            // Push data into array
+            hList.PushString(sName);
+        }
+    }
+    
+    // Close arrays
+    delete hTextures;
+    delete hDirectories;
+    return true;
+}
+
+/**
+ * @brief Loads the asset manifest from the data folder.
+ **/
+void DecryptLoadManifest(/*void*/)
+{
+    // Gets manifest path
+    static char sPath[PLATFORM_LINE_LENGTH];
+    BuildPath(Path_SM, sPath, sizeof(sPath), DECRYPT_MANIFEST_PATH);
+    
+    // Opens the file
+    File hFile = OpenFile(sPath, "rb");
+    
+    // If doesn't exist, then it will be created on the map end
+    if (hFile == null)
+    {
+        return;
+    }
+    
+    // Validate header
+    int iHeader[3];
+    if (hFile.Read(iHeader, sizeof(iHeader), 4) != sizeof(iHeader) || iHeader[0] != DECRYPT_MANIFEST_ID || iHeader[1] != DECRYPT_MANIFEST_VERSION)
+    {
+        LogEvent(false, LogType_Normal, LOG_CORE_EVENTS, LogModule_Decrypt, "Manifest Validation", "Outdated asset manifest: \"%s\", it will be rebuilt", sPath);
+        delete hFile;
+        return;
+    }
+    
+    // Initialize variables
+    static char sModel[PLATFORM_LINE_LENGTH]; static char sBuffer[PLATFORM_LINE_LENGTH]; any iData[Manifest_Length]; bool bValid = true;
+    
+    // i = entry index
+    for (int i = 0; i < iHeader[2] && bValid; i++)
+    {
+        // Reads entry key and stats
+        if (hFile.ReadString(sModel, sizeof(sModel)) <= 0 || hFile.Read(iData, Manifest_Materials, 4) != Manifest_Materials)
+        {
+            bValid = false;
+            break;
+        }
+        
+        // x = resource list
+        for (int x = Manifest_Materials; x < Manifest_Length; x++)
+        {
+            // Create list
+            ArrayList hList = new ArrayList(PLATFORM_LINE_LENGTH); iData[x] = hList;
+            
+            // Reads amount of paths
+            int iAmount;
+            if (!bValid || !hFile.ReadInt32(iAmount) || iAmount < 0 || iAmount > STUDIO_TEXTURE_MAX)
+            {
+                bValid = false;
+                continue;
+            }
+            
+            // j = path index
+            for (int j = 0; j < iAmount; j++)
+            {
+                // Reads a path
+                if (hFile.ReadString(sBuffer, sizeof(sBuffer)) <= 0)
+                {
+                    bValid = false;
+                    break;
+                }
+                
+                // Push data into array
+                hList.PushString(sBuffer);
+            }
+        }
+        
+        // If entry is broken, then drop it
+        if (!bValid)
+        {
+            for (int x = Manifest_Materials; x < Manifest_Length; x++)
+            {
+                delete view_as<ArrayList>(iData[x]);
+            }
+            break;
+        }
+        
+        // Store entry
+        gServerData.Manifest.SetArray(sModel, iData, Manifest_Length);
+    }
+    
+    // If file is broken, then rebuild it
+    if (!bValid)
+    {
+        LogEvent(false, LogType_Error, LOG_CORE_EVENTS, LogModule_Decrypt, "Manifest Validation", "Broken asset manifest: \"%s\", it will be rebuilt", sPath);
+        gServerData.ManifestChanged = true;
+    }
+    
+    // Close file
+    delete hFile;
+}
+
+/**
+ * @brief Stores the asset manifest into the data folder, if it was changed.
+ **/
+void DecryptSaveManifest(/*void*/)
+{
+    // If manifest is unchanged, then stop
+    if (!gServerData.ManifestChanged)
+    {
+        return;
+    }
+    
+    // Gets manifest path
+    static char sPath[PLATFORM_LINE_LENGTH];
+    BuildPath(Path_SM, sPath, sizeof(sPath), DECRYPT_MANIFEST_PATH);
+    
+    // Opens the file
+    File hFile = OpenFile(sPath, "wb");
+    
+    // If doesn't exist stop
+    if (hFile == null)
+    {
+        LogEvent(false, LogType_Error, LOG_CORE_EVENTS, LogModule_Decrypt, "Manifest Validation", "Error opening file: \"%s\"", sPath);
+        return;
+    }
+    
+    // Writes header, amount is updated at the end
+    hFile.WriteInt32(DECRYPT_MANIFEST_ID);
+    hFile.WriteInt32(DECRYPT_MANIFEST_VERSION);
+    hFile.WriteInt32(0);
+    
+    // Initialize variables
+    static char sModel[PLATFORM_LINE_LENGTH]; any iData[Manifest_Length]; int iCount;
+    StringMapSnapshot hSnapshot = gServerData.Manifest.Snapshot();
+    
+    // i = entry index
+    int iSize = hSnapshot.Length;
+    for (int i = 0; i < iSize; i++)
+    {
+        // Gets entry data
+        hSnapshot.GetKey(i, sModel, sizeof(sModel));
+        gServerData.Manifest.GetArray(sModel, iData, Manifest_Length);
+        
+        // Skip entries of removed files
+        if (!FileExists(sModel))
+        {
+            continue;
+        }
+        
+        // Writes entry key and stats
+        hFile.WriteString(sModel, true);
+        hFile.Write(iData, Manifest_Materials, 4);
+        
+        // x = resource list
+        for (int x = Manifest_Materials; x < Manifest_Length; x++)
+        {
+            // Writes amount of paths
+            ArrayList hList = iData[x];
+            int iAmount = hList.Length;
+            hFile.WriteInt32(iAmount);
+            
+            // j = path index
+            for (int j = 0; j < iAmount; j++)
+            {
+                hList.GetString(j, sPath, sizeof(sPath));
+                hFile.WriteString(sPath, true);
+            }
+        }
+        
+        // Update amount
+        iCount++;
+    }
+    
+    // Writes amount of entries
+    hFile.Seek(8, SEEK_SET);
+    hFile.WriteInt32(iCount);
+    
+    // Close file
+    delete hSnapshot;
+    delete hFile;
+    
+    // Manifest is stored
+    gServerData.ManifestChanged = false;
+}
+
+/**
+ * @brief Clears all entries of the asset manifest.
+ **/
+void DecryptClearManifest(/*void*/)
+{
+    // Initialize variables
+    static char sModel[PLATFORM_LINE_LENGTH]; any iData[Manifest_Length];
+    StringMapSnapshot hSnapshot = gServerData.Manifest.Snapshot();
+    
+    // i = entry index
+    int iSize = hSnapshot.Length;
+    for (int i = 0; i < iSize; i++)
+    {
+        // Gets entry data
+        hSnapshot.GetKey(i, sModel, sizeof(sModel));
+        gServerData.Manifest.GetArray(sModel, iData, Manifest_Length);
+        
+        // x = resource list
+        for (int x = Manifest_Materials; x < Manifest_Length; x++)
+        {
+            delete view_as<ArrayList>(iData[x]);
+        }
+    }
+    
+    // Clear map
+    gServerData.Manifest.Clear();
+    delete hSnapshot;
+}
+
+/**
+ * @brief Gets the manifest entry of a file and validates it against the file on disk.
+ *
+ * @note Entry is created or reset when it is missing or the file was changed.
+ *
+ * @param sModel            The file path.
+ * @param iFlag             The resource type to look for.
+ * @param iData             The array to return entry data in.
+ * @return                  True if the resource type is parsed and up to date, false otherwise.
+ **/
+bool DecryptGetManifest(char[] sModel, int iFlag, any iData[Manifest_Length])
+{
+    // Gets file stats
+    int iSize = FileSize(sModel);
+    int iTime = GetFileTime(sModel, FileTime_LastChange);
+    
+    // If entry doesn't exist, then create it
+    if (!gServerData.Manifest.GetArray(sModel, iData, Manifest_Length))
+    {
+        // Create lists
+        for (int x = Manifest_Materials; x < Manifest_Length; x++)
+        {
+            iData[x] = new ArrayList(PLATFORM_LINE_LENGTH);
+        }
+    }
+    // If file wasn't changed, then return cached data
+    else if (iData[Manifest_Size] == iSize && iData[Manifest_Time] == iTime)
+    {
+        return (iData[Manifest_Flags] & iFlag) != 0;
+    }
+    else
+    {
+        // Clear lists
+        for (int x = Manifest_Materials; x < Manifest_Length; x++)
+        {
+            view_as<ArrayList>(iData[x]).Clear();
+        }
+    }
+    
+    // Resets entry
+    iData[Manifest_Size] = iSize;
+    iData[Manifest_Time] = iTime;
+    iData[Manifest_Flags] = 0;
+    DecryptSetManifest(sModel, iData);
+    return false;
+}
+
+/**
+ * @brief Stores the manifest entry of a file.
+ *
+ * @param sModel            The file path.
+ * @param iData             The entry data.
+ **/
+void DecryptSetManifest(char[] sModel, any iData[Manifest_Length])
+{
+    // Store entry
+    gServerData.Manifest.SetArray(sModel, iData, Manifest_Length);
+    gServerData.ManifestChanged = true;
+}
+
+/**
+ * @brief Precache resources of a file from its manifest entry.
+ *
+ * @param sModel            The file path.
+ * @param iData             The entry data.
+ * @param iFlag             The resource types to precache.
+ **/
+void DecryptPrecacheManifest(char[] sModel, any iData[Manifest_Length], int iFlag)
+{
+    // Initialize variables
+    static char sPath[PLATFORM_LINE_LENGTH];
+    
+    // Validate materials
+    if (iFlag & MANIFEST_MATERIALS)
+    {
+        // i = material index
+        ArrayList hList = iData[Manifest_Materials];
+        int iSize = hList.Length;
+        for (int i = 0; i < iSize; i++)
+        {
+            // Precache material textures, which are checked once per map
+            hList.GetString(i, sPath, sizeof(sPath));
+            DecryptPrecacheTextures(sModel, sPath);
+        }
+    }
+    
+    // Validate sounds
+    if (iFlag & MANIFEST_SOUNDS)
+    {
+        // i = path index
+        ArrayList hList = iData[Manifest_Sounds];
+        int iSize = hList.Length;
+        for (int i = 0; i < iSize; i++)
+        {
+            // Add file to download table
+            hList.GetString(i, sPath, sizeof(sPath));
+            SoundsPrecacheQuirk(sPath);
+        }
+    }
+}
+
+/**
+ * Console command callback (zp_decrypt_validate)
+ * @brief Compares the materials parsed from a model header with its legacy materials file.
+ * 
+ * @param client            The client index.
+ * @param iArguments        The number of arguments that were in the argument string.
+ **/ 
+public Action DecryptOnCommandCatched(int client, int iArguments)
+{
+    // If not enough arguments given, then stop
+    if (iArguments < 1)
+    {
+        ReplyToCommand(client, "Usage: zp_decrypt_validate <model path>");
+        return Plugin_Handled;
+    }
+    
+    // Initialize variables
+    static char sModel[PLATFORM_LINE_LENGTH]; static char sPath[PLATFORM_LINE_LENGTH];
+    GetCmdArg(1, sModel, sizeof(sModel));
+    
+    // Opens the file
+    File hFile = OpenFile(sModel, "rb");
+    
+    // If doesn't exist stop
+    if (hFile == null)
+    {
+        ReplyToCommand(client, "Error opening file: \"%s\"", sModel);
+        return Plugin_Handled;
+    }
+    
+    // Reads materials from the model header
+    ArrayList hList = new ArrayList(PLATFORM_LINE_LENGTH);
+    bool bValid = DecryptReadStudioMaterials(hFile, hList);
+    delete hFile;
+    
+    // If header is invalid, then stop
+    if (!bValid)
+    {
+        ReplyToCommand(client, "Invalid studio header in file: \"%s\"", sModel);
+        delete hList;
+        return Plugin_Handled;
+    }
+    
+    // Normalize parsed paths
+    int iSize = hList.Length;
+    for (int i = 0; i < iSize; i++)
+    {
+        hList.GetString(i, sPath, sizeof(sPath));
+        ReplaceString(sPath, sizeof(sPath), "/", "\\");
+        StringToLower(sPath);
+        hList.SetString(i, sPath);
+    }
+    
+    // Gets the legacy materials file
+    int iFormat = FindCharInString(sModel, '.', true);
+    StrExtract(sPath, sModel, 0, (iFormat != -1) ? iFormat : strlen(sModel));
+    StrCat(sPath, sizeof(sPath), "_materials.txt");
+    
+    // Opens the file
+    hFile = OpenFile(sPath, "rt");
+    
+    // If doesn't exist, then print parsed materials only
+    if (hFile == null)
+    {
+        ReplyToCommand(client, "No legacy file \"%s\", parsed %d material(s):", sPath, iSize);
+        for (int i = 0; i < iSize; i++)
+        {
+            hList.GetString(i, sPath, sizeof(sPath));
+            ReplyToCommand(client, "  %s", sPath);
+        }
+        delete hList;
+        return Plugin_Handled;
+    }
+    
+    // Initialize variables
+    ArrayList hFound = new ArrayList(); int iMatched; int iLegacy;
+    
+    // Read lines in the file
+    while (hFile.ReadLine(sPath, sizeof(sPath)))
+    {
+        // Trim off whitespace
+        TrimString(sPath);
+        
+        // If line is empty, then skip
+        if (!hasLength(sPath))
+        {
+            continue;
+        }
+        
+        // Normalize the path
+        ReplaceString(sPath, sizeof(sPath), "/", "\\");
+        StringToLower(sPath);
+        
+        // Validate parsed material
+        int iD = hList.FindString(sPath);
+        if (iD != -1)
+        {
+            hFound.Push(iD);
+            iMatched++;
+        }
+        else
+        {
+            ReplyToCommand(client, "  - %s (only in the legacy file)", sPath);
+            iLegacy++;
+        }
+    }
+    
+    // i = material index
+    for (int i = 0; i < iSize; i++)
+    {
+        // Validate missing materials
+        if (hFound.FindValue(i) == -1)
+        {
+            hList.GetString(i, sPath, sizeof(sPath));
+            ReplyToCommand(client, "  + %s (only in the header)", sPath);
+        }
+    }
+    
+    // Print totals
+    ReplyToCommand(client, "Matched: %d | Only in the legacy file: %d | Only in the header: %d", iMatched, iLegacy, iSize - hFound.Length);
+    
+    // Close file
+    delete hFile;
+    delete hList;
+    delete hFound;
+    return Plugin_Handled;
+}
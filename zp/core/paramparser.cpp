@@ -78,6 +78,105 @@ char sParamError[7][PLATFORM_LINE_LENGTH] = {
  * @return                  Returns error code if parsing error.
  **/
 int ParamParseString(ArrayList &arrayBuffer, char[] sParamString, int iMaxLen, char cSeparator)
+{
+    /*
+     *  VALIDATION OF INPUT AND BUFFERS
+     */
+
+    // Cut out comments at the end of a line
+    int iComment = StrContains(sParamString, "//");
+    if (iComment != -1) sParamString[iComment] = NULL_STRING[0];
+     
+    // Trim string
+    TrimString(sParamString);
+
+    // Gets string length
+    int iLen = strlen(sParamString);
+    
+    // Check if string is empty
+    if (!iLen)
+    {
+        strcopy(sParamString, iMaxLen, sParamError[PARAM_ERROR_EMPTY]);
+        return PARAM_ERROR_EMPTY;
+    }
+
+    // Check if there space left in the destination buffer
+    if (iMaxLen > PLATFORM_LINE_LENGTH || iLen > PLATFORM_LINE_LENGTH)
+    {
+        // Exit loop. No more parameters can be parsed
+        strcopy(sParamString, iMaxLen, sParamError[PARAM_ERROR_FULL]);
+        return PARAM_ERROR_FULL;
+    }
+    
+    /*__________________________________________________________________________*/
+
+    // Extract key name
+    int iPos; int iStart; int iCount; bool bQuoted;
+    int iError = ParamNextToken(sParamString, iPos, iStart, iCount, cSeparator, bQuoted);
+    
+    // Parse error
+    if (iError != PARAM_ERROR_NO || !iCount)
+    {
+        iError = (iError == PARAM_ERROR_MISSING_QUOTES) ? iError : PARAM_ERROR_UNEXPECTED_KEY;
+        strcopy(sParamString, iMaxLen, sParamError[iError]);
+        return iError;
+    }
+
+    // Validate separator after the key name
+    if (sParamString[iPos - 1] != cSeparator)
+    {
+        strcopy(sParamString, iMaxLen, sParamError[PARAM_ERROR_MISSING_SEPARATOR]);
+        return PARAM_ERROR_MISSING_SEPARATOR;
+    }
+    
+    // Push key name into array
+    ParamPushToken(arrayBuffer, sParamString, iStart, iCount, bQuoted);
+
+    /*__________________________________________________________________________*/
+
+    // Extract first value
+    iError = ParamNextToken(sParamString, iPos, iStart, iCount, ',', bQuoted);
+    
+    // Check if value is empty, then stop
+    if (iError == PARAM_ERROR_EMPTY)
+    {
+        strcopy(sParamString, iMaxLen, sParamError[PARAM_ERROR_UNEXPECTED_END]);
+        return PARAM_ERROR_UNEXPECTED_END;
+    }
+    
+    // Extract values, quoted ones can hold commas
+    while (iError == PARAM_ERROR_NO)
+    {
+        // Push value string into array
+        ParamPushToken(arrayBuffer, sParamString, iStart, iCount, bQuoted);
+        
+        // Extract next value
+        iError = ParamNextToken(sParamString, iPos, iStart, iCount, ',', bQuoted);
+    }
+    
+    // Parse error
+    if (iError != PARAM_ERROR_EMPTY)
+    {
+        strcopy(sParamString, iMaxLen, sParamError[iError]);
+        return iError;
+    }
+
+    // Return on success
+    return PARAM_ERROR_NO;
+}
+
+/**
+ * @brief Parses a parameter string with ExplodeString, the same as the parser before the span tokenizer.
+ *
+ * @note Kept only to measure the span tokenizer against it.
+ *
+ * @param arrayBuffer       Handle of the buffer array containing value data.
+ * @param sParamString      The source string to parse. Error message output.
+ * @param iMaxLen           Maximum number of keys that can be stored (first dimension of buffer).
+ * @param cSeparator        The separator character.
+ * @return                  Returns error code if parsing error.
+ **/
+int ParamParseExplode(ArrayList arrayBuffer, char[] sParamString, int iMaxLen, char cSeparator)
 {
     /*
      *  VALIDATION OF INPUT AND BUFFERS
@@ -202,11 +301,154 @@ int ParamParseString(ArrayList &arrayBuffer, char[] sParamString, int iMaxLen, c
         }
     }
 
-
     // Return on success
     return PARAM_ERROR_NO;
 }
 
+/**
+ * @brief Finds the next token of a parameter string as a span, without copying it.
+ *
+ * @note Tokens are trimmed and split by the separator. A quoted token can hold separators
+ *       and escaped chars (\" and \\), the span excludes the quotes but keeps the escapes.
+ *
+ * @param sParamString      The source string.
+ * @param iPos              The position to search from, moved past the token and its separator.
+ * @param iStart            The start position of the token.
+ * @param iLen              The length of the token.
+ * @param cSeparator        The separator character.
+ * @param bQuoted           True if token was quoted, so it can hold escapes.
+ * @return                  PARAM_ERROR_NO if token was found, PARAM_ERROR_EMPTY at the end of string, or error code if parsing error.
+ **/
+int ParamNextToken(char[] sParamString, int &iPos, int &iStart, int &iLen, char cSeparator, bool &bQuoted)
+{
+    // Skip whitespace before the token
+    while (IsCharSpace(sParamString[iPos]) && sParamString[iPos] != cSeparator) iPos++;
+    
+    // Validate end of string
+    if (sParamString[iPos] == NULL_STRING[0])
+    {
+        return PARAM_ERROR_EMPTY;
+    }
+    
+    // Validate quoted token
+    bQuoted = (sParamString[iPos] == '"');
+    if (bQuoted)
+    {
+        // Find the closing quote
+        iStart = ++iPos;
+        for (;;)
+        {
+            // Gets position of the next quote
+            int iQuote = FindCharInString(sParamString[iPos], '"');
+            if (iQuote == -1)
+            {
+                return PARAM_ERROR_MISSING_QUOTES;
+            }
+            iPos += iQuote;
+            
+            // Count backslashes before the quote
+            int iSlash;
+            while (iPos - iSlash > iStart && sParamString[iPos - iSlash - 1] == '\\') iSlash++;
+            
+            // Stop, if the quote isn't escaped
+            if (!(iSlash & 1))
+            {
+                break;
+            }
+            iPos++;
+        }
+        iLen = iPos++ - iStart;
+        
+        // Skip whitespace after the token
+        while (IsCharSpace(sParamString[iPos]) && sParamString[iPos] != cSeparator) iPos++;
+        
+        // Validate separator after the token
+        if (sParamString[iPos] != cSeparator && sParamString[iPos] != NULL_STRING[0])
+        {
+            return PARAM_ERROR_MISSING_SEPARATOR;
+        }
+    }
+    else
+    {
+        // Find the separator
+        iStart = iPos;
+        int iEnd = FindCharInString(sParamString[iPos], cSeparator);
+        iPos += (iEnd == -1) ? strlen(sParamString[iPos]) : iEnd;
+        
+        // Trim whitespace after the token
+        iLen = iPos - iStart;
+        while (iLen && IsCharSpace(sParamString[iStart + iLen - 1])) iLen--;
+    }
+    
+    // Skip the separator
+    if (sParamString[iPos] == cSeparator) iPos++;
+    return PARAM_ERROR_NO;
+}
+
+/**
+ * @brief Pushes a token span into the array, unescaping it only when needed.
+ *
+ * @param arrayBuffer       Handle of the buffer array.
+ * @param sParamString      The source string.
+ * @param iStart            The start position of the token.
+ * @param iLen              The length of the token.
+ * @param bQuoted           True if token was quoted, only then escapes are removed.
+ **/
+void ParamPushToken(ArrayList arrayBuffer, char[] sParamString, int iStart, int iLen, bool bQuoted)
+{
+    // Validate escapes in the quoted span
+    int iSlash = bQuoted ? FindCharInString(sParamString[iStart], '\\') : -1;
+    if (iSlash != -1 && iSlash < iLen)
+    {
+        // Copy unescaped token
+        static char sToken[PLATFORM_LINE_LENGTH];
+        ParamCopyToken(sParamString, iStart, iLen, sToken, sizeof(sToken));
+        arrayBuffer.PushString(sToken);
+        return;
+    }
+    
+    // Terminate the token in place
+    int iEnd = iStart + iLen; char cEnd = sParamString[iEnd];
+    sParamString[iEnd] = NULL_STRING[0];
+    
+    // Push token string into array
+    arrayBuffer.PushString(sParamString[iStart]);
+    
+    // Restore the source string
+    sParamString[iEnd] = cEnd;
+}
+
+/**
+ * @brief Copies a token span into the buffer and unescapes it.
+ *
+ * @param sParamString      The source string.
+ * @param iStart            The start position of the token.
+ * @param iLen              The length of the token.
+ * @param sBuffer           The destination string buffer.
+ * @param iMaxLen           The length of the buffer.
+ * @return                  The number of chars written.
+ **/
+int ParamCopyToken(char[] sParamString, int iStart, int iLen, char[] sBuffer, int iMaxLen)
+{
+    // i = char index
+    int iEnd = iStart + iLen; int x;
+    for (int i = iStart; i < iEnd && x < iMaxLen - 1; i++)
+    {
+        // Skip escape char
+        if (sParamString[i] == '\\' && i + 1 < iEnd)
+        {
+            i++;
+        }
+        
+        // Copy char
+        sBuffer[x++] = sParamString[i];
+    }
+    
+    // Terminate string
+    sBuffer[x] = NULL_STRING[0];
+    return x;
+}
+
 /**************************************
  *                                    *
  *         HELPER FUNCTIONS           *
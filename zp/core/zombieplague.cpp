@@ -54,6 +54,58 @@
  * @endsection
  **/
 
+/**
+ * @section List of modules loaded on the map start.
+ **/
+enum /*LoadModule*/
+{
+    Load_Config,                  /** Configs module */
+    Load_Sounds,                  /** Sounds module */
+    Load_Weapons,                 /** Weapons module */
+    Load_VEffects,                /** Visual effects module */
+    Load_Downloads,               /** Downloads module */
+    Load_Classes,                 /** Classes module */
+    Load_Costumes,                /** Costumes module */
+    Load_GameModes,               /** Game modes module */
+    Load_ExtraItems,              /** Extra items module */
+    Load_HitGroups,               /** Hitgroups module */
+    Load_Menus,                   /** Menus module (deferred) */
+    Load_Levels,                  /** Level system module (deferred) */
+    Load_Version,                 /** Version info (deferred) */
+
+    Load_Size
+};
+/**
+ * @endsection
+ **/
+
+/**
+ * @brief First module which is not needed for the first spawn.
+ * @note Modules from here don't precache anything and aren't read by ZP_OnEngineExecute() subscribers, 
+ *       so they can be loaded over the next frames.
+ **/
+#define LOAD_DEFERRED Load_Menus
+
+/**
+ * @section Struct of the map load queue.
+ **/
+enum struct LoadData
+{
+    int Next;                     /** Next module in the queue, Load_Size when nothing is pending */
+    float Critical;               /** Time spent on the critical modules in seconds */
+    float Deferred;               /** Time spent on the deferred modules in seconds */
+    int Frames;                   /** Amount of frames used by the deferred modules */
+    float Time[Load_Size];        /** Load time of each module in seconds */
+}
+/**
+ * @endsection
+ **/
+ 
+/**
+ * Array to store the map load queue.
+ **/
+LoadData gLoadData;
+
 /**
  * @brief Called once when server is started. Will log a warning if a unsupported game is detected.
  **/
@@ -155,6 +207,27 @@ void GameEngineOnInit(/*void*/)
     // Load other offsets
     fnInitGameConfOffset(gServerData.Config, view_as<int>(gServerData.Platform), "CServer::OS");
     gServerData.Engine = fnCreateEngineInterface(gServerData.Config, "EngineInterface");
+    
+    // Queue is empty until the map start
+    gLoadData.Next = Load_Size;
+}
+
+/**
+ * @brief Hook core cvar changes.
+ **/
+void GameEngineOnCvarInit(/*void*/)
+{
+    // Create cvars
+    gCvarList.LOAD_BUDGET = FindConVar("zp_load_budget");
+}
+
+/**
+ * @brief Creates commands for core module.
+ **/
+void GameEngineOnCommandInit(/*void*/)
+{
+    // Hook commands
+    RegAdminCmd("zp_load_stats", GameEngineOnCommandCatched, ADMFLAG_CONFIG, "Prints the load time of each module on the last map start. Usage: zp_load_stats");
 }
 
 /**
@@ -162,11 +235,29 @@ void GameEngineOnInit(/*void*/)
  **/
 void GameEngineOnLoad(/*void*/)
 {
-    // Call forward
+    // Resets the queue
+    gLoadData.Next = Load_Config;
+    gLoadData.Critical = 0.0;
+    gLoadData.Deferred = 0.0;
+    gLoadData.Frames = 0;
+    
+    // Load modules needed for the first spawn
+    while (gLoadData.Next < LOAD_DEFERRED)
+    {
+        gLoadData.Critical += GameEngineOnLoadNext();
+    }
+    
+    // Call forward, sub-plugins precache there, so it has to be inside the map start
     gForwardData._OnEngineExecute();
     
     // Map is load
     gServerData.MapLoaded = true;
+    
+    // If budget is disabled, then load the rest now
+    if (gCvarList.LOAD_BUDGET.FloatValue <= 0.0)
+    {
+        GameEngineOnLoadFlush();
+    }
 }
 
 /**
@@ -174,10 +265,192 @@ void GameEngineOnLoad(/*void*/)
  **/
 void GameEngineOnPurge(/*void*/)
 {
+    // Drop the queue
+    gLoadData.Next = Load_Size;
+    
     // Clear map bool
     gServerData.MapLoaded = false;
 }
 
+/**
+ * @brief Called on each game frame.
+ **/
+void GameEngineOnFrame(/*void*/)
+{
+    // If queue is empty, then stop
+    if (gLoadData.Next >= Load_Size)
+    {
+        return;
+    }
+    
+    // Gets frame budget in seconds
+    float flBudget = gCvarList.LOAD_BUDGET.FloatValue * 0.001;
+    float flStart = GetEngineTime();
+    
+    // Load at least one module per frame
+    do
+    {
+        gLoadData.Deferred += GameEngineOnLoadNext();
+    }
+    while (gLoadData.Next < Load_Size && GetEngineTime() - flStart < flBudget);
+    
+    // Update frames
+    gLoadData.Frames++;
+}
+
+/**
+ * @brief Called once a client successfully connects.
+ *
+ * @param client            The client index.
+ **/
+void GameEngineOnClientConnect(int client)
+{
+    #pragma unused client
+    
+    // Players need the deferred modules, so load them now
+    GameEngineOnLoadFlush();
+}
+
+/**
+ * @brief Loads all pending modules at once.
+ **/
+void GameEngineOnLoadFlush(/*void*/)
+{
+    // Loop until queue is empty
+    while (gLoadData.Next < Load_Size)
+    {
+        gLoadData.Deferred += GameEngineOnLoadNext();
+    }
+}
+
+/**
+ * @brief Loads the next module in the queue.
+ *
+ * @return                  The load time in seconds.
+ **/
+float GameEngineOnLoadNext(/*void*/)
+{
+    // Gets module index
+    int iD = gLoadData.Next++;
+    
+    // Start measuring
+    Profiler hProfiler = new Profiler();
+    hProfiler.Start();
+    
+    // Forward event to module
+    switch (iD)
+    {
+        case Load_Config :     ConfigOnLoad();
+        case Load_Sounds :     SoundsOnLoad();
+        case Load_Weapons :    WeaponsOnLoad();
+        case Load_VEffects :   VEffectsOnLoad();
+        case Load_Downloads :  DownloadsOnLoad();
+        case Load_Classes :    ClassesOnLoad();
+        case Load_Costumes :   CostumesOnLoad();
+        case Load_GameModes :  GameModesOnLoad();
+        case Load_ExtraItems : ExtraItemsOnLoad();
+        case Load_HitGroups :  HitGroupsOnLoad();
+        case Load_Menus :      MenusOnLoad();
+        case Load_Levels :     LevelSystemOnLoad();
+        case Load_Version :    VersionOnLoad();
+    }
+    
+    // Stop measuring
+    hProfiler.Stop();
+    float flTime = gLoadData.Time[iD] = hProfiler.Time;
+    delete hProfiler;
+    
+    // If it was the last one, then finish load
+    if (gLoadData.Next == Load_Size)
+    {
+        GameEngineOnLoadFinish();
+    }
+    
+    // Return on success
+    return flTime;
+}
+
+/**
+ * @brief Called when all modules are loaded.
+ **/
+void GameEngineOnLoadFinish(/*void*/)
+{
+    // Log load times
+    LogEvent(true, LogType_Normal, LOG_CORE_EVENTS, LogModule_Engine, "Map Load", "Critical modules: %.3f ms | Deferred modules: %.3f ms over %d frame(s)", gLoadData.Critical * 1000.0, gLoadData.Deferred * 1000.0, gLoadData.Frames);
+    LogEvent(true, LogType_Normal, LOG_CORE_EVENTS, LogModule_Engine, "Map Load", "Material cache: %d hit(s), %d parse(s), %d texture hit(s), ~%.3f ms saved", gServerData.MaterialHits, gServerData.MaterialParses, gServerData.TextureHits, GameEngineGetMaterialSaved() * 1000.0);
+}
+
+/**
+ * Console command callback (zp_load_stats)
+ * @brief Prints the load time of each module on the last map start.
+ * 
+ * @param client            The client index.
+ * @param iArguments        The number of arguments that were in the argument string.
+ **/ 
+public Action GameEngineOnCommandCatched(int client, int iArguments)
+{
+    // Initialize variables
+    static char sModule[SMALL_LINE_LENGTH];
+    
+    // Print header
+    ReplyToCommand(client, "%-12s %10s %12s", "Module", "Stage", "Load (ms)");
+    
+    // i = module index
+    for (int i = Load_Config; i < Load_Size; i++)
+    {
+        // Gets module name
+        GameEngineGetModuleName(i, sModule, sizeof(sModule));
+        
+        // Print module timing
+        ReplyToCommand(client, "%-12s %10s %12.3f", sModule, (i < LOAD_DEFERRED) ? "critical" : "deferred", gLoadData.Time[i] * 1000.0);
+    }
+    
+    // Print totals
+    ReplyToCommand(client, "Critical: %.3f ms | Deferred: %.3f ms over %d frame(s)%s", gLoadData.Critical * 1000.0, gLoadData.Deferred * 1000.0, gLoadData.Frames, (gLoadData.Next < Load_Size) ? " (pending)" : "");
+    ReplyToCommand(client, "Material cache: %d hit(s), %d parse(s), %d texture hit(s), ~%.3f ms saved", gServerData.MaterialHits, gServerData.MaterialParses, gServerData.TextureHits, GameEngineGetMaterialSaved() * 1000.0);
+    return Plugin_Handled;
+}
+
+/**
+ * @brief Gets the estimated time saved by the material cache.
+ *
+ * @return                  The time in seconds.
+ **/
+float GameEngineGetMaterialSaved(/*void*/)
+{
+    // Average parse time of a material for each skipped one
+    return gServerData.MaterialParses ? gServerData.MaterialTime / float(gServerData.MaterialParses) * float(gServerData.MaterialHits) : 0.0;
+}
+
+/**
+ * @brief Gets the name of a load module.
+ *
+ * @param iD                The module index.
+ * @param sName             The string to return name in.
+ * @param iMaxLen           The lenght of string.
+ **/
+void GameEngineGetModuleName(int iD, char[] sName, int iMaxLen)
+{
+    // Gets module name
+    switch (iD)
+    {
+        case Load_Config :     strcopy(sName, iMaxLen, "config");
+        case Load_Sounds :     strcopy(sName, iMaxLen, "sounds");
+        case Load_Weapons :    strcopy(sName, iMaxLen, "weapons");
+        case Load_VEffects :   strcopy(sName, iMaxLen, "veffects");
+        case Load_Downloads :  strcopy(sName, iMaxLen, "downloads");
+        case Load_Classes :    strcopy(sName, iMaxLen, "classes");
+        case Load_Costumes :   strcopy(sName, iMaxLen, "costumes");
+        case Load_GameModes :  strcopy(sName, iMaxLen, "gamemodes");
+        case Load_ExtraItems : strcopy(sName, iMaxLen, "extraitems");
+        case Load_HitGroups :  strcopy(sName, iMaxLen, "hitgroups");
+        case Load_Menus :      strcopy(sName, iMaxLen, "menus");
+        case Load_Levels :     strcopy(sName, iMaxLen, "levels");
+        case Load_Version :    strcopy(sName, iMaxLen, "version");
+        default :              strcopy(sName, iMaxLen, "unknown");
+    }
+}
+
 /*
  * Stocks core API.
  */
@@ -38,6 +38,22 @@ enum EngineOS
  * @endsection
  **/
  
+/**
+ * @section Player hitgroup values.
+ **/
+#define HITGROUP_GENERIC    0
+#define HITGROUP_HEAD       1
+#define HITGROUP_CHEST      2
+#define HITGROUP_STOMACH    3
+#define HITGROUP_LEFTARM    4
+#define HITGROUP_RIGHTARM   5
+#define HITGROUP_LEFTLEG    6
+#define HITGROUP_RIGHTLEG   7
+#define HITGROUP_GEAR       8
+/**
+ * @endsection
+ **/
+
 /**
  * @section Struct of operation types for server arrays.
  **/
@@ -79,8 +95,27 @@ enum struct ServerData
 
     /* Database */
     Database DBI;
+    Database Outbox;
+    bool OutboxBusy;
+    Transaction OutboxTxn;
+    DataPack OutboxPack;
+    ArrayList OutboxSaves;
+    ArrayList OutboxLoads;
+    int OutboxFailID;
+    int OutboxFailCount;
+    bool MySQL;
     StringMap Cols;
     StringMapSnapshot Columns;
+    Handle FlushTimer;
+    Handle StatsTimer;
+    Profiler Clock;
+    ArrayList Queries;
+    ArrayList Stats;
+    int InFlight;
+    ArrayList Top;
+    int TopTotal;
+    Handle TopTimer;
+    StringMap Pending;
     
     /* Synchronizers */
     Handle LevelSync;
@@ -104,6 +139,32 @@ enum struct ServerData
     StringMap Configs;
     StringMap Modules;
     
+    /* Indexes */
+    StringMap ClassesIndex;
+    StringMap TypesIndex;
+    StringMap WeaponsIndex;
+    StringMap ItemsIndex;
+    StringMap CostumesIndex;
+    StringMap ModesIndex;
+    StringMap HitGroupsIndex;
+    StringMap SoundsIndex;
+    int HitGroupsTable[HITGROUP_GEAR + 1]; /* Engine hitgroup to the config index */
+    
+    /* Classes */
+    ArrayList ClassRegistry;
+    ArrayList ClassPool;
+    ArrayList ClassArrays;
+    
+    /* Decryptor */
+    StringMap Manifest;
+    bool ManifestChanged;
+    StringMap MaterialCache;
+    StringMap TextureCache;
+    int MaterialHits;
+    int MaterialParses;
+    int TextureHits;
+    float MaterialTime;
+    
     /* Weapons */
     int Melee;
     StringMap Market;
@@ -151,8 +212,17 @@ enum struct ClientData
     int Time;
     bool Vision;
     int DataID;
+    int DataBits;
+    int Rank;
     int LastID;
     int LastAttacker;
+    int HintVictim;
+    int HintDamage;
+    int HintHealth;
+    int HintArmor;
+    float HintTime;
+    float KnockVelocity[3];
+    bool KnockPending;
     int TeleTimes;
     int TeleCounter;
     float TeleOrigin[3];
@@ -173,6 +243,7 @@ enum struct ClientData
     int SwapWeapon;
     int LastSequence;
     int LastSequenceParity;
+    int Shield;
     bool ToggleSequence;
     bool RunCmd;
     
@@ -192,6 +263,7 @@ enum struct ClientData
     /* Arrays */
     ArrayList ShoppingCart;
     ArrayList DefaultCart;
+    ArrayList StoredCart;
     StringMap ItemLimit;
     StringMap WeaponLimit;
     
@@ -218,8 +290,17 @@ enum struct ClientData
         this.Time                 = 0;
         this.Vision               = true;
         this.DataID               = -1;
+        this.DataBits             = 0;
+        this.Rank                 = 0;
         this.LastID               = -1;
         this.LastAttacker         = 0;
+        this.HintVictim           = 0;
+        this.HintDamage           = 0;
+        this.HintHealth           = 0;
+        this.HintArmor            = 0;
+        this.HintTime             = 0.0;
+        this.KnockVelocity        = NULL_VECTOR;
+        this.KnockPending         = false;
         this.TeleTimes            = 0;
         this.TeleCounter          = 0;
         this.TeleOrigin           = NULL_VECTOR;
@@ -250,11 +331,13 @@ enum struct ClientData
         this.SwapWeapon           = -1;
         this.LastSequence         = -1;
         this.LastSequenceParity   = -1;
+        this.Shield               = -1;
         this.ToggleSequence       = false;
         this.RunCmd               = false;
        
         delete this.ShoppingCart;
         delete this.DefaultCart;
+        delete this.StoredCart;
         delete this.ItemLimit;
         delete this.WeaponLimit;
     }
@@ -218,6 +218,7 @@ void ClassesOnLoad(/*void*/)
     ConfigSetConfigLoaded(File_Classes, true);
     ConfigSetConfigReloadFunc(File_Classes, GetFunctionByName(GetMyHandle(), "ClassesOnConfigReload"));
     ConfigSetConfigHandle(File_Classes, gServerData.Classes);
+    ConfigSetConfigIncremental(File_Classes, true);
 }
 
 /**
@@ -252,6 +253,10 @@ void ClassesOnCacheData(/*void*/)
         gServerData.Types.Clear();
     }
     
+    // Creates the name and type indexes
+    gServerData.ClassesIndex = ConfigCreateIndex(gServerData.ClassesIndex);
+    gServerData.TypesIndex = ConfigCreateIndex(gServerData.TypesIndex, true);
+    
     // Validate size
     int iSize = gServerData.Classes.Length;
     if (!iSize)
@@ -263,8 +268,20 @@ void ClassesOnCacheData(/*void*/)
     // i = array index
     for (int i = 0; i < iSize; i++)
     {
+        // Initialize array block
+        ArrayList arrayClass = gServerData.Classes.Get(i);
+        
         // General
-        ClassGetName(i, sPathClasses, sizeof(sPathClasses)); // Index: 0
+        arrayClass.GetString(CLASSES_DATA_NAME, sPathClasses, sizeof(sPathClasses)); // Index: 0
+        
+        // Skip removed classes, they keep the data for current players
+        ConfigEntryState iState = ConfigGetEntryState(File_Classes, i);
+        if (iState == EntryState_Removed)
+        {
+            continue;
+        }
+        
+        ConfigSetIndex(gServerData.ClassesIndex, sPathClasses, i);
         kvClasses.Rewind();
         if (!kvClasses.JumpToKey(sPathClasses))
         {
@@ -281,9 +298,19 @@ void ClassesOnCacheData(/*void*/)
             LogEvent(false, LogType_Error, LOG_GAME_EVENTS, LogModule_Classes, "Config Validation", "Couldn't cache class name: \"%s\" (check translation file)", sPathClasses);
             continue;
         }
-
-        // Initialize array block
-        ArrayList arrayClass = gServerData.Classes.Get(i);
+        
+        // Validate unchanged class
+        if (iState == EntryState_Keep)
+        {
+            // Register cached type
+            arrayClass.GetString(CLASSES_DATA_TYPE, sPathClasses, sizeof(sPathClasses));
+            if (gServerData.Types.FindString(sPathClasses) == -1)
+            {
+                gServerData.Types.PushString(sPathClasses); /// Unique type catched
+            }
+            ConfigSetIndex(gServerData.TypesIndex, sPathClasses, i, true);
+            continue;
+        }
 
         // Push data into array
         kvClasses.GetString("info", sPathClasses, sizeof(sPathClasses), ""); StringToLower(sPathClasses);
@@ -304,6 +331,7 @@ void ClassesOnCacheData(/*void*/)
         {
             gServerData.Types.PushString(sPathClasses); /// Unique type catched
         }
+        ConfigSetIndex(gServerData.TypesIndex, sPathClasses, i, true);
         arrayClass.Push(ConfigKvGetStringBool(kvClasses, "zombie", "no"));      // Index: 3
         kvClasses.GetString("model", sPathClasses, sizeof(sPathClasses), "");
         arrayClass.PushString(sPathClasses);                                    // Index: 4
@@ -347,39 +375,30 @@ void ClassesOnCacheData(/*void*/)
             DecryptPrecacheTextures("self", sPathClasses);
         }
         kvClasses.GetString("weapon", sPathClasses, sizeof(sPathClasses), "");
-        static char sWeapon[SMALL_LINE_LENGTH][SMALL_LINE_LENGTH]; int iWeapon[SMALL_LINE_LENGTH] = { -1, ... };
-        int nWeapon = ExplodeString(sPathClasses, ",", sWeapon, sizeof(sWeapon), sizeof(sWeapon[]));
-        for (int x = 0; x < nWeapon; x++)
+        int iWeapon[SMALL_LINE_LENGTH] = { -1, ... }; int iPos; int iStart; int iLen; bool bQuoted;
+        for (int x = 0; x < sizeof(iWeapon) && ParamNextToken(sPathClasses, iPos, iStart, iLen, ',', bQuoted) == PARAM_ERROR_NO; x++)
         {
-            // Trim string
-            TrimString(sWeapon[x]);
+            // Terminate token in place
+            sPathClasses[iStart + iLen] = NULL_STRING[0];
 
             // Push data into array
-            iWeapon[x] = WeaponsNameToIndex(sWeapon[x]);
+            iWeapon[x] = WeaponsNameToIndex(sPathClasses[iStart]);
         } 
         arrayClass.PushArray(iWeapon, sizeof(iWeapon));                         // Index: 31
         kvClasses.GetString("money", sPathClasses, sizeof(sPathClasses), "");
-        static char sMoney[6][SMALL_LINE_LENGTH]; int iMoney[6];
-        int nMoney = ExplodeString(sPathClasses, ",", sMoney, sizeof(sMoney), sizeof(sMoney[]));
-        for (int x = 0; x < nMoney; x++)
+        int iMoney[6]; iPos = 0;
+        for (int x = 0; x < sizeof(iMoney) && ParamNextToken(sPathClasses, iPos, iStart, iLen, ',', bQuoted) == PARAM_ERROR_NO; x++)
         {
-            // Trim string
-            TrimString(sWeapon[x]);
-
             // Push data into array
-            iMoney[x] = StringToInt(sMoney[x]);
+            iMoney[x] = StringToInt(sPathClasses[iStart]);
         }
         arrayClass.PushArray(iMoney, sizeof(iMoney));                           // Index: 32
         kvClasses.GetString("experience", sPathClasses, sizeof(sPathClasses), "");
-        static char sExp[6][SMALL_LINE_LENGTH]; int iExp[6];
-        int nExp = ExplodeString(sPathClasses, ",", sExp, sizeof(sExp), sizeof(sExp[]));
-        for (int x = 0; x < nExp; x++)
+        int iExp[6]; iPos = 0;
+        for (int x = 0; x < sizeof(iExp) && ParamNextToken(sPathClasses, iPos, iStart, iLen, ',', bQuoted) == PARAM_ERROR_NO; x++)
         {
-            // Trim string
-            TrimString(sWeapon[x]);
-
             // Push data into array
-            iExp[x] = StringToInt(sExp[x]);
+            iExp[x] = StringToInt(sPathClasses[iStart]);
         }
         arrayClass.PushArray(iExp, sizeof(iExp));                               // Index: 33
         arrayClass.Push(kvClasses.GetNum("lifesteal", 0));                      // Index: 34
@@ -416,6 +435,96 @@ void ClassesOnCacheData(/*void*/)
 
     // We're done with this file now, so we can close it
     delete kvClasses;
+    
+    // Builds the class registry
+    ClassesOnCacheRegistry();
+}
+
+/**
+ * @brief Flattens the cached class data into the class registry.
+ * 
+ * @note The registry keeps one row per class with a cell per CLASSES_DATA_* index.
+ *       Numeric cells hold the value, string and array cells hold the slot in their pool,
+ *       so each getter reads a single row instead of the nested class array.
+ **/
+void ClassesOnCacheRegistry(/*void*/)
+{
+    // If arrays haven't been created, then create
+    if (gServerData.ClassRegistry == null)
+    {
+        // Initialize a registry and its pools
+        gServerData.ClassRegistry = new ArrayList(CLASSES_DATA_SOUNDJUMP + 1);
+        gServerData.ClassPool = new ArrayList(NORMAL_LINE_LENGTH);
+        gServerData.ClassArrays = new ArrayList(SMALL_LINE_LENGTH);
+    }
+    else
+    {
+        // Clear out the arrays of all data
+        gServerData.ClassRegistry.Clear();
+        gServerData.ClassPool.Clear();
+        gServerData.ClassArrays.Clear();
+    }
+    
+    // Initialize some variables
+    static char sBuffer[PLATFORM_LINE_LENGTH]; static int iBuffer[SMALL_LINE_LENGTH];
+    
+    // i = class index
+    int iSize = gServerData.Classes.Length;
+    for (int i = 0; i < iSize; i++)
+    {
+        // Gets array handle of class at given index
+        ArrayList arrayClass = gServerData.Classes.Get(i);
+        
+        // Gets amount of cached data (only name for invalid classes)
+        int iLength = arrayClass.Length;
+        
+        // Push new row into the registry
+        int iRow = gServerData.ClassRegistry.Push(-1);
+
+        // x = data index
+        for (int x = 0; x <= CLASSES_DATA_SOUNDJUMP; x++)
+        {
+            switch (x)
+            {
+                case CLASSES_DATA_NAME, CLASSES_DATA_INFO, CLASSES_DATA_TYPE, CLASSES_DATA_MODEL, CLASSES_DATA_CLAW, CLASSES_DATA_GRENADE, CLASSES_DATA_ARM, CLASSES_DATA_GROUP, CLASSES_DATA_OVERLAY, CLASSES_DATA_EFFECTNAME, CLASSES_DATA_EFFECTATTACH :
+                {
+                    // Gets string value
+                    if (x < iLength) arrayClass.GetString(x, sBuffer, sizeof(sBuffer)); else sBuffer[0] = NULL_STRING[0];
+                    
+                    // Push string into pool
+                    gServerData.ClassRegistry.Set(iRow, gServerData.ClassPool.PushString(sBuffer), x);
+                }
+                
+                case CLASSES_DATA_WEAPON, CLASSES_DATA_MONEY, CLASSES_DATA_EXP :
+                {
+                    // Validate array value
+                    if (x < iLength)
+                    {
+                        // Gets array value
+                        arrayClass.GetArray(x, iBuffer, sizeof(iBuffer));
+                    }
+                    else
+                    {
+                        // y = cell index
+                        for (int y = 0; y < sizeof(iBuffer); y++)
+                        {
+                            // Sets default value
+                            iBuffer[y] = (x == CLASSES_DATA_WEAPON) ? -1 : 0;
+                        }
+                    }
+                    
+                    // Push array into pool
+                    gServerData.ClassRegistry.Set(iRow, gServerData.ClassArrays.PushArray(iBuffer, sizeof(iBuffer)), x);
+                }
+                
+                default :
+                {
+                    // Sets numeric value
+                    gServerData.ClassRegistry.Set(iRow, (x < iLength) ? arrayClass.Get(x) : 0, x);
+                }
+            }
+        }
+    }
 }
 
 /**
@@ -2111,11 +2220,8 @@ public int API_GetClassSoundJumpID(Handle hPlugin, int iNumParams)
  **/
 void ClassGetName(int iD, char[] sName, int iMaxLen)
 {
-    // Gets array handle of class at given index
-    ArrayList arrayClass = gServerData.Classes.Get(iD);
-
-    // Gets class name
-    arrayClass.GetString(CLASSES_DATA_NAME, sName, iMaxLen);
+    // Gets class name from the string pool
+    gServerData.ClassPool.GetString(gServerData.ClassRegistry.Get(iD, CLASSES_DATA_NAME), sName, iMaxLen);
 }
 
 /**
@@ -2127,11 +2233,8 @@ void ClassGetName(int iD, char[] sName, int iMaxLen)
  **/
 void ClassGetInfo(int iD, char[] sInfo, int iMaxLen)
 {
-    // Gets array handle of class at given index
-    ArrayList arrayClass = gServerData.Classes.Get(iD);
-
-    // Gets class info
-    arrayClass.GetString(CLASSES_DATA_INFO, sInfo, iMaxLen);
+    // Gets class info from the string pool
+    gServerData.ClassPool.GetString(gServerData.ClassRegistry.Get(iD, CLASSES_DATA_INFO), sInfo, iMaxLen);
 }
 
 /**
@@ -2143,11 +2246,8 @@ void ClassGetInfo(int iD, char[] sInfo, int iMaxLen)
  **/
 void ClassGetType(int iD, char[] sType, int iMaxLen)
 {
-    // Gets array handle of class at given index
-    ArrayList arrayClass = gServerData.Classes.Get(iD);
-
-    // Gets class type
-    arrayClass.GetString(CLASSES_DATA_TYPE, sType, iMaxLen);
+    // Gets class type from the string pool
+    gServerData.ClassPool.GetString(gServerData.ClassRegistry.Get(iD, CLASSES_DATA_TYPE), sType, iMaxLen);
 }
 
 /**
@@ -2158,11 +2258,8 @@ void ClassGetType(int iD, char[] sType, int iMaxLen)
  **/
 bool ClassIsZombie(int iD)
 {
-    // Gets array handle of class at given index
-    ArrayList arrayClass = gServerData.Classes.Get(iD);
-
-    // Gets class zombie type
-    return arrayClass.Get(CLASSES_DATA_ZOMBIE);
+    // Gets class zombie type from the registry
+    return gServerData.ClassRegistry.Get(iD, CLASSES_DATA_ZOMBIE);
 }
 
 /**
@@ -2174,11 +2271,8 @@ bool ClassIsZombie(int iD)
  **/
 void ClassGetModel(int iD, char[] sModel, int iMaxLen)
 {
-    // Gets array handle of class at given index
-    ArrayList arrayClass = gServerData.Classes.Get(iD);
-
-    // Gets class model
-    arrayClass.GetString(CLASSES_DATA_MODEL, sModel, iMaxLen);
+    // Gets class model from the string pool
+    gServerData.ClassPool.GetString(gServerData.ClassRegistry.Get(iD, CLASSES_DATA_MODEL), sModel, iMaxLen);
 }
 
 /**
@@ -2190,11 +2284,8 @@ void ClassGetModel(int iD, char[] sModel, int iMaxLen)
  **/
 void ClassGetClawModel(int iD, char[] sModel, int iMaxLen)
 {
-    // Gets array handle of class at given index
-    ArrayList arrayClass = gServerData.Classes.Get(iD);
-
-    // Gets class claw model
-    arrayClass.GetString(CLASSES_DATA_CLAW, sModel, iMaxLen);
+    // Gets class claw model from the string pool
+    gServerData.ClassPool.GetString(gServerData.ClassRegistry.Get(iD, CLASSES_DATA_CLAW), sModel, iMaxLen);
 }
 
 /**
@@ -2206,11 +2297,8 @@ void ClassGetClawModel(int iD, char[] sModel, int iMaxLen)
  **/
 void ClassGetGrenadeModel(int iD, char[] sModel, int iMaxLen)
 {
-    // Gets array handle of class at given index
-    ArrayList arrayClass = gServerData.Classes.Get(iD);
-
-    // Gets class grenade model
-    arrayClass.GetString(CLASSES_DATA_GRENADE, sModel, iMaxLen);
+    // Gets class grenade model from the string pool
+    gServerData.ClassPool.GetString(gServerData.ClassRegistry.Get(iD, CLASSES_DATA_GRENADE), sModel, iMaxLen);
 }
 
 /**
@@ -2222,11 +2310,8 @@ void ClassGetGrenadeModel(int iD, char[] sModel, int iMaxLen)
  **/
 void ClassGetArmModel(int iD, char[] sModel, int iMaxLen)
 {
-    // Gets array handle of class at given index
-    ArrayList arrayClass = gServerData.Classes.Get(iD);
-
-    // Gets class arm model
-    arrayClass.GetString(CLASSES_DATA_ARM, sModel, iMaxLen);
+    // Gets class arm model from the string pool
+    gServerData.ClassPool.GetString(gServerData.ClassRegistry.Get(iD, CLASSES_DATA_ARM), sModel, iMaxLen);
 }
 
 /**
@@ -2237,11 +2322,8 @@ void ClassGetArmModel(int iD, char[] sModel, int iMaxLen)
  **/
 int ClassGetBody(int iD)
 {
-    // Gets array handle of class at given index
-    ArrayList arrayClass = gServerData.Classes.Get(iD);
-
-    // Gets class body
-    return arrayClass.Get(CLASSES_DATA_BODY);
+    // Gets class body from the registry
+    return gServerData.ClassRegistry.Get(iD, CLASSES_DATA_BODY);
 }
 
 /**
@@ -2252,11 +2334,8 @@ int ClassGetBody(int iD)
  **/
 int ClassGetSkin(int iD)
 {
-    // Gets array handle of class at given index
-    ArrayList arrayClass = gServerData.Classes.Get(iD);
-
-    // Gets class skin
-    return arrayClass.Get(CLASSES_DATA_SKIN);
+    // Gets class skin from the registry
+    return gServerData.ClassRegistry.Get(iD, CLASSES_DATA_SKIN);
 }
 
 /**
@@ -2267,11 +2346,8 @@ int ClassGetSkin(int iD)
  **/
 int ClassGetHealth(int iD)
 {
-    // Gets array handle of class at given index
-    ArrayList arrayClass = gServerData.Classes.Get(iD);
-
-    // Gets class health
-    return arrayClass.Get(CLASSES_DATA_HEALTH);
+    // Gets class health from the registry
+    return gServerData.ClassRegistry.Get(iD, CLASSES_DATA_HEALTH);
 }
 
 /**
@@ -2282,11 +2358,8 @@ int ClassGetHealth(int iD)
  **/
 float ClassGetSpeed(int iD)
 {
-    // Gets array handle of class at given index
-    ArrayList arrayClass = gServerData.Classes.Get(iD);
-
-    // Gets class speed 
-    return arrayClass.Get(CLASSES_DATA_SPEED);
+    // Gets class speed from the registry
+    return gServerData.ClassRegistry.Get(iD, CLASSES_DATA_SPEED);
 }
 
 /**
@@ -2297,11 +2370,8 @@ float ClassGetSpeed(int iD)
  **/
 float ClassGetGravity(int iD)
 {
-    // Gets array handle of class at given index
-    ArrayList arrayClass = gServerData.Classes.Get(iD);
-
-    // Gets class speed 
-    return arrayClass.Get(CLASSES_DATA_GRAVITY);
+    // Gets class gravity from the registry
+    return gServerData.ClassRegistry.Get(iD, CLASSES_DATA_GRAVITY);
 }
 
 /**
@@ -2312,11 +2382,8 @@ float ClassGetGravity(int iD)
  **/
 float ClassGetKnockBack(int iD)
 {
-    // Gets array handle of class at given index
-    ArrayList arrayClass = gServerData.Classes.Get(iD);
-
-    // Gets class knockback 
-    return arrayClass.Get(CLASSES_DATA_KNOCKBACK);
+    // Gets class knockback from the registry
+    return gServerData.ClassRegistry.Get(iD, CLASSES_DATA_KNOCKBACK);
 }
 
 /**
@@ -2327,11 +2394,8 @@ float ClassGetKnockBack(int iD)
  **/
 int ClassGetArmor(int iD)
 {
-    // Gets array handle of class at given index
-    ArrayList arrayClass = gServerData.Classes.Get(iD);
-
-    // Gets class armor 
-    return arrayClass.Get(CLASSES_DATA_ARMOR);
+    // Gets class armor from the registry
+    return gServerData.ClassRegistry.Get(iD, CLASSES_DATA_ARMOR);
 }
 
 /**
@@ -2342,11 +2406,8 @@ int ClassGetArmor(int iD)
  **/
 int ClassGetLevel(int iD)
 {
-    // Gets array handle of class at given index
-    ArrayList arrayClass = gServerData.Classes.Get(iD);
-
-    // Gets class level 
-    return arrayClass.Get(CLASSES_DATA_LEVEL);
+    // Gets class level from the registry
+    return gServerData.ClassRegistry.Get(iD, CLASSES_DATA_LEVEL);
 }
 
 /**
@@ -2358,11 +2419,8 @@ int ClassGetLevel(int iD)
  **/
 void ClassGetGroup(int iD, char[] sGroup, int iMaxLen)
 {
-    // Gets array handle of class at given index
-    ArrayList arrayClass = gServerData.Classes.Get(iD);
-
-    // Gets class group
-    arrayClass.GetString(CLASSES_DATA_GROUP, sGroup, iMaxLen);
+    // Gets class group from the string pool
+    gServerData.ClassPool.GetString(gServerData.ClassRegistry.Get(iD, CLASSES_DATA_GROUP), sGroup, iMaxLen);
 }
 
 /**
@@ -2373,11 +2431,8 @@ void ClassGetGroup(int iD, char[] sGroup, int iMaxLen)
  **/
 float ClassGetSkillDuration(int iD)
 {
-    // Gets array handle of class at given index
-    ArrayList arrayClass = gServerData.Classes.Get(iD);
-
-    // Gets class skill duration 
-    return arrayClass.Get(CLASSES_DATA_SKILLDURATION);
+    // Gets class skill duration from the registry
+    return gServerData.ClassRegistry.Get(iD, CLASSES_DATA_SKILLDURATION);
 }
 
 /**
@@ -2388,11 +2443,8 @@ float ClassGetSkillDuration(int iD)
  **/
 float ClassGetSkillCountdown(int iD)
 {
-    // Gets array handle of class at given index
-    ArrayList arrayClass = gServerData.Classes.Get(iD);
-
-    // Gets class skill countdown  
-    return arrayClass.Get(CLASSES_DATA_SKILLCOUNTDOWN);
+    // Gets class skill countdown from the registry
+    return gServerData.ClassRegistry.Get(iD, CLASSES_DATA_SKILLCOUNTDOWN);
 }
 
 /**
@@ -2403,11 +2455,8 @@ float ClassGetSkillCountdown(int iD)
  **/
 bool ClassIsSkillBar(int iD)
 {
-    // Gets array handle of class at given index
-    ArrayList arrayClass = gServerData.Classes.Get(iD);
-
-    // Gets class skill bar  
-    return arrayClass.Get(CLASSES_DATA_SKILLBAR);
+    // Gets class skill bar from the registry
+    return gServerData.ClassRegistry.Get(iD, CLASSES_DATA_SKILLBAR);
 }
 
 /**
@@ -2418,11 +2467,8 @@ bool ClassIsSkillBar(int iD)
  **/
 bool ClassIsHealthSprite(int iD)
 {
-    // Gets array handle of class at given index
-    ArrayList arrayClass = gServerData.Classes.Get(iD);
-
-    // Gets class health sprite  
-    return arrayClass.Get(CLASSES_DATA_HEALTHSPRITE);
+    // Gets class health sprite from the registry
+    return gServerData.ClassRegistry.Get(iD, CLASSES_DATA_HEALTHSPRITE);
 }
 
 /**
@@ -2433,11 +2479,8 @@ bool ClassIsHealthSprite(int iD)
  **/
 int ClassGetRegenHealth(int iD)
 {
-    // Gets array handle of class at given index
-    ArrayList arrayClass = gServerData.Classes.Get(iD);
-
-    // Gets class regen health
-    return arrayClass.Get(CLASSES_DATA_REGENHEALTH);
+    // Gets class regen health from the registry
+    return gServerData.ClassRegistry.Get(iD, CLASSES_DATA_REGENHEALTH);
 }
 
 /**
@@ -2448,11 +2491,8 @@ int ClassGetRegenHealth(int iD)
  **/
 float ClassGetRegenInterval(int iD)
 {
-    // Gets array handle of class at given index
-    ArrayList arrayClass = gServerData.Classes.Get(iD);
-
-    // Gets class regen interval
-    return arrayClass.Get(CLASSES_DATA_REGENINTERVAL);
+    // Gets class regen interval from the registry
+    return gServerData.ClassRegistry.Get(iD, CLASSES_DATA_REGENINTERVAL);
 }
 
 /**
@@ -2463,11 +2503,8 @@ float ClassGetRegenInterval(int iD)
  **/
 bool ClassIsFall(int iD)
 {
-    // Gets array handle of class at given index
-    ArrayList arrayClass = gServerData.Classes.Get(iD);
-
-    // Gets class fall state
-    return arrayClass.Get(CLASSES_DATA_FALL);
+    // Gets class fall state from the registry
+    return gServerData.ClassRegistry.Get(iD, CLASSES_DATA_FALL);
 }
 
 /**
@@ -2478,11 +2515,8 @@ bool ClassIsFall(int iD)
  **/
 bool ClassIsSpot(int iD)
 {
-    // Gets array handle of class at given index
-    ArrayList arrayClass = gServerData.Classes.Get(iD);
-
-    // Gets class spot state
-    return arrayClass.Get(CLASSES_DATA_SPOTTED);
+    // Gets class spot state from the registry
+    return gServerData.ClassRegistry.Get(iD, CLASSES_DATA_SPOTTED);
 }
 
 /**
@@ -2493,11 +2527,8 @@ bool ClassIsSpot(int iD)
  **/
 int ClassGetFov(int iD)
 {
-    // Gets array handle of class at given index
-    ArrayList arrayClass = gServerData.Classes.Get(iD);
-
-    // Gets class fov amount
-    return arrayClass.Get(CLASSES_DATA_FOV);
+    // Gets class fov amount from the registry
+    return gServerData.ClassRegistry.Get(iD, CLASSES_DATA_FOV);
 }
 
 /**
@@ -2508,11 +2539,8 @@ int ClassGetFov(int iD)
  **/
 bool ClassIsCross(int iD)
 {
-    // Gets array handle of class at given index
-    ArrayList arrayClass = gServerData.Classes.Get(iD);
-
-    // Gets class crosshair state
-    return arrayClass.Get(CLASSES_DATA_CROSSHAIR);
+    // Gets class crosshair state from the registry
+    return gServerData.ClassRegistry.Get(iD, CLASSES_DATA_CROSSHAIR);
 }
 
 /**
@@ -2523,11 +2551,8 @@ bool ClassIsCross(int iD)
  **/
 bool ClassIsNvgs(int iD)
 {
-    // Gets array handle of class at given index
-    ArrayList arrayClass = gServerData.Classes.Get(iD);
-
-    // Gets class nightvision state
-    return arrayClass.Get(CLASSES_DATA_NVGS);
+    // Gets class nightvision state from the registry
+    return gServerData.ClassRegistry.Get(iD, CLASSES_DATA_NVGS);
 }
 
 /**
@@ -2539,11 +2564,8 @@ bool ClassIsNvgs(int iD)
  **/
 void ClassGetOverlay(int iD, char[] sOverlay, int iMaxLen)
 {
-    // Gets array handle of class at given index
-    ArrayList arrayClass = gServerData.Classes.Get(iD);
-
-    // Gets class overlay
-    arrayClass.GetString(CLASSES_DATA_OVERLAY, sOverlay, iMaxLen);
+    // Gets class overlay from the string pool
+    gServerData.ClassPool.GetString(gServerData.ClassRegistry.Get(iD, CLASSES_DATA_OVERLAY), sOverlay, iMaxLen);
 }
 
 /**
@@ -2555,11 +2577,8 @@ void ClassGetOverlay(int iD, char[] sOverlay, int iMaxLen)
  **/
 void ClassGetWeapon(int iD, int[] iWeapon, int iMaxLen)
 {
-    // Gets array handle of class at given index
-    ArrayList arrayClass = gServerData.Classes.Get(iD);
-
-    // Gets class weapon
-    arrayClass.GetArray(CLASSES_DATA_WEAPON, iWeapon, iMaxLen);
+    // Gets class weapon from the array pool
+    gServerData.ClassArrays.GetArray(gServerData.ClassRegistry.Get(iD, CLASSES_DATA_WEAPON), iWeapon, iMaxLen);
 }
 
 /**
@@ -2571,11 +2590,8 @@ void ClassGetWeapon(int iD, int[] iWeapon, int iMaxLen)
  **/
 void ClassGetMoney(int iD, int[] iMoney, int iMaxLen)
 {
-    // Gets array handle of class at given index
-    ArrayList arrayClass = gServerData.Classes.Get(iD);
-
-    // Gets class money
-    arrayClass.GetArray(CLASSES_DATA_MONEY, iMoney, iMaxLen);
+    // Gets class money from the array pool
+    gServerData.ClassArrays.GetArray(gServerData.ClassRegistry.Get(iD, CLASSES_DATA_MONEY), iMoney, iMaxLen);
 }
 
 /**
@@ -2587,11 +2603,8 @@ void ClassGetMoney(int iD, int[] iMoney, int iMaxLen)
  **/
 void ClassGetExp(int iD, int[] iExp, int iMaxLen)
 {
-    // Gets array handle of class at given index
-    ArrayList arrayClass = gServerData.Classes.Get(iD);
-
-    // Gets class experience
-    arrayClass.GetArray(CLASSES_DATA_EXP, iExp, iMaxLen);
+    // Gets class experience from the array pool
+    gServerData.ClassArrays.GetArray(gServerData.ClassRegistry.Get(iD, CLASSES_DATA_EXP), iExp, iMaxLen);
 }
 
 /**
@@ -2602,11 +2615,8 @@ void ClassGetExp(int iD, int[] iExp, int iMaxLen)
  **/
 int ClassGetLifeSteal(int iD)
 {
-    // Gets array handle of class at given index
-    ArrayList arrayClass = gServerData.Classes.Get(iD);
-
-    // Gets class lifesteal amount
-    return arrayClass.Get(CLASSES_DATA_LIFESTEAL);
+    // Gets class lifesteal amount from the registry
+    return gServerData.ClassRegistry.Get(iD, CLASSES_DATA_LIFESTEAL);
 }
 
 /**
@@ -2617,11 +2627,8 @@ int ClassGetLifeSteal(int iD)
  **/
 int ClassGetAmmunition(int iD)
 {
-    // Gets array handle of class at given index
-    ArrayList arrayClass = gServerData.Classes.Get(iD);
-
-    // Gets class ammunition type
-    return arrayClass.Get(CLASSES_DATA_AMMUNITION);
+    // Gets class ammunition type from the registry
+    return gServerData.ClassRegistry.Get(iD, CLASSES_DATA_AMMUNITION);
 }
 
 /**
@@ -2632,11 +2639,8 @@ int ClassGetAmmunition(int iD)
  **/
 int ClassGetLeapJump(int iD)
 {
-    // Gets array handle of class at given index
-    ArrayList arrayClass = gServerData.Classes.Get(iD);
-
-    // Gets class leap jump
-    return arrayClass.Get(CLASSES_DATA_LEAPJUMP);
+    // Gets class leap jump from the registry
+    return gServerData.ClassRegistry.Get(iD, CLASSES_DATA_LEAPJUMP);
 }
 
 /**
@@ -2647,11 +2651,8 @@ int ClassGetLeapJump(int iD)
  **/
 float ClassGetLeapForce(int iD)
 {
-    // Gets array handle of class at given index
-    ArrayList arrayClass = gServerData.Classes.Get(iD);
-
-    // Gets class leap force
-    return arrayClass.Get(CLASSES_DATA_LEAPFORCE);
+    // Gets class leap force from the registry
+    return gServerData.ClassRegistry.Get(iD, CLASSES_DATA_LEAPFORCE);
 }
 
 /**
@@ -2662,11 +2663,8 @@ float ClassGetLeapForce(int iD)
  **/
 float ClassGetLeapCountdown(int iD)
 {
-    // Gets array handle of class at given index
-    ArrayList arrayClass = gServerData.Classes.Get(iD);
-
-    // Gets class leap countdown
-    return arrayClass.Get(CLASSES_DATA_LEAPCOUNTDOWN);
+    // Gets class leap countdown from the registry
+    return gServerData.ClassRegistry.Get(iD, CLASSES_DATA_LEAPCOUNTDOWN);
 }
 
 /**
@@ -2678,11 +2676,8 @@ float ClassGetLeapCountdown(int iD)
  **/
 void ClassGetEffectName(int iD, char[] sName, int iMaxLen)
 {
-    // Gets array handle of class at given index
-    ArrayList arrayClass = gServerData.Classes.Get(iD);
-
-    // Gets class effect name
-    arrayClass.GetString(CLASSES_DATA_EFFECTNAME, sName, iMaxLen);
+    // Gets class effect name from the string pool
+    gServerData.ClassPool.GetString(gServerData.ClassRegistry.Get(iD, CLASSES_DATA_EFFECTNAME), sName, iMaxLen);
 }
 
 /**
@@ -2694,11 +2689,8 @@ void ClassGetEffectName(int iD, char[] sName, int iMaxLen)
  **/
 void ClassGetEffectAttach(int iD, char[] sAttach, int iMaxLen)
 {
-    // Gets array handle of class at given index
-    ArrayList arrayClass = gServerData.Classes.Get(iD);
-
-    // Gets class effect attach
-    arrayClass.GetString(CLASSES_DATA_EFFECTATTACH, sAttach, iMaxLen);
+    // Gets class effect attach from the string pool
+    gServerData.ClassPool.GetString(gServerData.ClassRegistry.Get(iD, CLASSES_DATA_EFFECTATTACH), sAttach, iMaxLen);
 }
 
 /**
@@ -2709,11 +2701,8 @@ void ClassGetEffectAttach(int iD, char[] sAttach, int iMaxLen)
  **/
 float ClassGetEffectTime(int iD)
 {
-    // Gets array handle of class at given index
-    ArrayList arrayClass = gServerData.Classes.Get(iD);
-
-    // Gets class effect time
-    return arrayClass.Get(CLASSES_DATA_EFFECTTIME);
+    // Gets class effect time from the registry
+    return gServerData.ClassRegistry.Get(iD, CLASSES_DATA_EFFECTTIME);
 }
 
 /**
@@ -2724,11 +2713,8 @@ float ClassGetEffectTime(int iD)
  **/
 int ClassGetClawID(int iD)
 {
-    // Gets array handle of class at given index
-    ArrayList arrayClass = gServerData.Classes.Get(iD);
-
-    // Gets class claw model index
-    return arrayClass.Get(CLASSES_DATA_CLAW_);
+    // Gets class claw model index from the registry
+    return gServerData.ClassRegistry.Get(iD, CLASSES_DATA_CLAW_);
 }
 
 /**
@@ -2739,11 +2725,8 @@ int ClassGetClawID(int iD)
  **/
 int ClassGetGrenadeID(int iD)
 {
-    // Gets array handle of class at given index
-    ArrayList arrayClass = gServerData.Classes.Get(iD);
-
-    // Gets class grenade model index
-    return arrayClass.Get(CLASSES_DATA_GRENADE_);
+    // Gets class grenade model index from the registry
+    return gServerData.ClassRegistry.Get(iD, CLASSES_DATA_GRENADE_);
 }
 
 /**
@@ -2754,11 +2737,8 @@ int ClassGetGrenadeID(int iD)
  **/
 int ClassGetSoundDeathID(int iD)
 {
-    // Gets array handle of class at given index
-    ArrayList arrayClass = gServerData.Classes.Get(iD);
-
-    // Gets class death sound key
-    return arrayClass.Get(CLASSES_DATA_SOUNDDEATH);
+    // Gets class death sound key from the registry
+    return gServerData.ClassRegistry.Get(iD, CLASSES_DATA_SOUNDDEATH);
 }
 
 /**
@@ -2769,11 +2749,8 @@ int ClassGetSoundDeathID(int iD)
  **/
 int ClassGetSoundHurtID(int iD)
 {
-    // Gets array handle of class at given index
-    ArrayList arrayClass = gServerData.Classes.Get(iD);
-
-    // Gets class hurt sound key
-    return arrayClass.Get(CLASSES_DATA_SOUNDHURT);
+    // Gets class hurt sound key from the registry
+    return gServerData.ClassRegistry.Get(iD, CLASSES_DATA_SOUNDHURT);
 }
 
 /**
@@ -2784,11 +2761,8 @@ int ClassGetSoundHurtID(int iD)
  **/
 int ClassGetSoundIdleID(int iD)
 {
-    // Gets array handle of class at given index
-    ArrayList arrayClass = gServerData.Classes.Get(iD);
-
-    // Gets class idle sound key
-    return arrayClass.Get(CLASSES_DATA_SOUNDIDLE);
+    // Gets class idle sound key from the registry
+    return gServerData.ClassRegistry.Get(iD, CLASSES_DATA_SOUNDIDLE);
 }
 
 /**
@@ -2799,11 +2773,8 @@ int ClassGetSoundIdleID(int iD)
  **/
 int ClassGetSoundInfectID(int iD)
 {
-    // Gets array handle of class at given index
-    ArrayList arrayClass = gServerData.Classes.Get(iD);
-
-    // Gets class infect sound key
-    return arrayClass.Get(CLASSES_DATA_SOUNDINFECT);
+    // Gets class infect sound key from the registry
+    return gServerData.ClassRegistry.Get(iD, CLASSES_DATA_SOUNDINFECT);
 }
 
 /**
@@ -2814,11 +2785,8 @@ int ClassGetSoundInfectID(int iD)
  **/
 int ClassGetSoundRespawnID(int iD)
 {
-    // Gets array handle of class at given index
-    ArrayList arrayClass = gServerData.Classes.Get(iD);
-
-    // Gets class respawn sound key
-    return arrayClass.Get(CLASSES_DATA_SOUNDRESPAWN);
+    // Gets class respawn sound key from the registry
+    return gServerData.ClassRegistry.Get(iD, CLASSES_DATA_SOUNDRESPAWN);
 }
 
 /**
@@ -2829,11 +2797,8 @@ int ClassGetSoundRespawnID(int iD)
  **/
 int ClassGetSoundBurnID(int iD)
 {
-    // Gets array handle of class at given index
-    ArrayList arrayClass = gServerData.Classes.Get(iD);
-
-    // Gets class idle sound key
-    return arrayClass.Get(CLASSES_DATA_SOUNDBURN);
+    // Gets class burn sound key from the registry
+    return gServerData.ClassRegistry.Get(iD, CLASSES_DATA_SOUNDBURN);
 }
 
 /**
@@ -2844,11 +2809,8 @@ int ClassGetSoundBurnID(int iD)
  **/
 int ClassGetSoundAttackID(int iD)
 {
-    // Gets array handle of class at given index
-    ArrayList arrayClass = gServerData.Classes.Get(iD);
-
-    // Gets class idle sound key
-    return arrayClass.Get(CLASSES_DATA_SOUNDATTACK);
+    // Gets class attack sound key from the registry
+    return gServerData.ClassRegistry.Get(iD, CLASSES_DATA_SOUNDATTACK);
 }
 
 /**
@@ -2859,11 +2821,8 @@ int ClassGetSoundAttackID(int iD)
  **/
 int ClassGetSoundFootID(int iD)
 {
-    // Gets array handle of class at given index
-    ArrayList arrayClass = gServerData.Classes.Get(iD);
-
-    // Gets class footstep sound key
-    return arrayClass.Get(CLASSES_DATA_SOUNDFOOTSTEP);
+    // Gets class footstep sound key from the registry
+    return gServerData.ClassRegistry.Get(iD, CLASSES_DATA_SOUNDFOOTSTEP);
 }
 
 /**
@@ -2874,11 +2833,8 @@ int ClassGetSoundFootID(int iD)
  **/
 int ClassGetSoundRegenID(int iD)
 {
-    // Gets array handle of class at given index
-    ArrayList arrayClass = gServerData.Classes.Get(iD);
-
-    // Gets class regeneration sound key
-    return arrayClass.Get(CLASSES_DATA_SOUNDREGEN);
+    // Gets class regeneration sound key from the registry
+    return gServerData.ClassRegistry.Get(iD, CLASSES_DATA_SOUNDREGEN);
 }
 
 /**
@@ -2889,17 +2845,26 @@ int ClassGetSoundRegenID(int iD)
  **/
 int ClassGetSoundJumpID(int iD)
 {
-    // Gets array handle of class at given index
-    ArrayList arrayClass = gServerData.Classes.Get(iD);
-
-    // Gets class leap jump sound key
-    return arrayClass.Get(CLASSES_DATA_SOUNDJUMP);
+    // Gets class leap jump sound key from the registry
+    return gServerData.ClassRegistry.Get(iD, CLASSES_DATA_SOUNDJUMP);
 }
 
 /*
  * Stocks classes API.
  */
 
+/**
+ * @brief Returns true if the class was removed from the config by a reload.
+ * 
+ * @param iD                The class index.
+ * @return                  True or false.
+ **/
+bool ClassIsRemoved(int iD)
+{
+    // Gets class state
+    return ConfigIsEntryRemoved(File_Classes, iD);
+}
+
 /**
  * @brief Find the index at which the class name is at.
  * 
@@ -2908,26 +2873,8 @@ int ClassGetSoundJumpID(int iD)
  **/
 int ClassNameToIndex(char[] sName)
 {
-    // Initialize name char
-    static char sClassname[SMALL_LINE_LENGTH];
-    
-    // i = class index
-    int iSize = gServerData.Classes.Length;
-    for (int i = 0; i < iSize; i++)
-    {
-        // Gets class name 
-        ClassGetName(i, sClassname, sizeof(sClassname));
-        
-        // If names match, then return index
-        if (!strcmp(sName, sClassname, false))
-        {
-            // Return this index
-            return i;
-        }
-    }
-    
-    // Name doesn't exist
-    return -1;
+    // Gets index from the name index
+    return ConfigGetIndex(gServerData.ClassesIndex, sName);
 }
 
 /**
@@ -2938,24 +2885,6 @@ int ClassNameToIndex(char[] sName)
  **/
 int ClassTypeToIndex(char[] sType)
 {
-    // Initialize type char
-    static char sClassType[SMALL_LINE_LENGTH]; 
-    
-    // i = class index
-    int iSize = gServerData.Classes.Length; int iRandom; static int class[MAXPLAYERS+1];
-    for (int i = 0; i < iSize; i++)
-    {
-        // Gets class type 
-        ClassGetType(i, sClassType, sizeof(sClassType));
-        
-        // If types match, then store index
-        if (!strcmp(sClassType, sType, false))
-        {
-            // Increment amount
-            class[iRandom++] = i;
-        }
-    }
-    
-    // Return index
-    return (iRandom) ? class[GetRandomInt(0, iRandom-1)] : -1;
+    // Gets random index from the type index
+    return ConfigGetIndex(gServerData.TypesIndex, sType, true);
 }
\ No newline at end of file
@@ -176,6 +176,9 @@ void CostumesOnCacheData(/*void*/)
         return;
     }
 
+    // Creates the name index
+    gServerData.CostumesIndex = ConfigCreateIndex(gServerData.CostumesIndex);
+    
     // Validate size
     int iSize = gServerData.Costumes.Length;
     if (!iSize)
@@ -189,6 +192,7 @@ void CostumesOnCacheData(/*void*/)
     {
         // General
         CostumesGetName(i, sPathCostumes, sizeof(sPathCostumes)); // Index: 0
+        ConfigSetIndex(gServerData.CostumesIndex, sPathCostumes, i);
         kvCostumes.Rewind();
         if (!kvCostumes.JumpToKey(sPathCostumes))
         {
@@ -951,26 +955,8 @@ int CostumesGetLevel(int iD)
  **/
 int CostumesNameToIndex(char[] sName)
 {
-    // Initialize name char
-    static char sCostumeName[SMALL_LINE_LENGTH];
-    
-    // i = costume index
-    int iSize = gServerData.Costumes.Length;
-    for (int i = 0; i < iSize; i++)
-    {
-        // Gets costume name 
-        CostumesGetName(i, sCostumeName, sizeof(sCostumeName));
-        
-        // If names match, then return index
-        if (!strcmp(sName, sCostumeName, false))
-        {
-            // Return this index
-            return i;
-        }
-    }
-    
-    // Name doesn't exist
-    return -1;
+    // Gets index from the name index
+    return ConfigGetIndex(gServerData.CostumesIndex, sName);
 }
  
 /**
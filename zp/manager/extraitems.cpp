@@ -105,6 +105,9 @@ void ExtraItemsOnCacheData(/*void*/)
         return;
     }
     
+    // Creates the name index
+    gServerData.ItemsIndex = ConfigCreateIndex(gServerData.ItemsIndex);
+    
     // Validate size
     int iSize = gServerData.ExtraItems.Length;
     if (!iSize)
@@ -118,6 +121,7 @@ void ExtraItemsOnCacheData(/*void*/)
     {
         // General
         ItemsGetName(i, sPathItems, sizeof(sPathItems)); // Index: 0
+        ConfigSetIndex(gServerData.ItemsIndex, sPathItems, i);
         kvExtraItems.Rewind();
         if (!kvExtraItems.JumpToKey(sPathItems))
         {
@@ -790,26 +794,8 @@ void ItemsGetClass(int iD, char[] sClass, int iMaxLen)
  **/
 int ItemsNameToIndex(char[] sName)
 {
-    // Initialize name char
-    static char sItemName[SMALL_LINE_LENGTH];
-    
-    // i = item index
-    int iSize = gServerData.ExtraItems.Length;
-    for (int i = 0; i < iSize; i++)
-    {
-        // Gets item name 
-        ItemsGetName(i, sItemName, sizeof(sItemName));
-        
-        // If names match, then return index
-        if (!strcmp(sName, sItemName, false))
-        {
-            // Return this index
-            return i;
-        }
-    }
-    
-    // Name doesn't exist
-    return -1;
+    // Gets index from the name index
+    return ConfigGetIndex(gServerData.ItemsIndex, sName);
 }
 
 /**
@@ -172,6 +172,9 @@ void GameModesOnCacheData(/*void*/)
         return;
     }
 
+    // Creates the name index
+    gServerData.ModesIndex = ConfigCreateIndex(gServerData.ModesIndex);
+    
     // Validate size
     int iSize = gServerData.GameModes.Length;
     if (!iSize)
@@ -185,6 +188,7 @@ void GameModesOnCacheData(/*void*/)
     {
         // General
         ModesGetName(i, sPathModes, sizeof(sPathModes)); // Index: 0
+        ConfigSetIndex(gServerData.ModesIndex, sPathModes, i);
         kvGameModes.Rewind();
         if (!kvGameModes.JumpToKey(sPathModes))
         {
@@ -852,6 +856,7 @@ public Action CS_OnTerminateRound(float& flDelay, CSRoundEndReason& reason)
     
     // Forward event to modules
     SoundsOnRoundEnd(reason);
+    DataBaseOnRoundEnd();
     
     // Call forward
     gForwardData._OnGameModeEnd(reason);
@@ -2999,26 +3004,8 @@ bool ModesIsExtraItem(int iD)
  **/
 int ModesNameToIndex(char[] sName)
 {
-    // Initialize name char
-    static char sModeName[SMALL_LINE_LENGTH];
-    
-    // i = mode index
-    int iSize = gServerData.GameModes.Length;
-    for (int i = 0; i < iSize; i++)
-    {
-        // Gets mode name 
-        ModesGetName(i, sModeName, sizeof(sModeName));
-        
-        // If names match, then return index
-        if (!strcmp(sName, sModeName, false))
-        {
-            // Return this index
-            return i;
-        }
-    }
-    
-    // Name doesn't exist
-    return -1;
+    // Gets index from the name index
+    return ConfigGetIndex(gServerData.ModesIndex, sName);
 }
 
 /**
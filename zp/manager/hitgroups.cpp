@@ -26,20 +26,72 @@
  **/
 
 /**
- * @section Player hitgroup values.
- **/
-#define HITGROUP_GENERIC    0
-#define HITGROUP_HEAD       1
-#define HITGROUP_CHEST      2
-#define HITGROUP_STOMACH    3
-#define HITGROUP_LEFTARM    4
-#define HITGROUP_RIGHTARM   5
-#define HITGROUP_LEFTLEG    6
-#define HITGROUP_RIGHTLEG   7
-#define HITGROUP_GEAR       8
+ * @section Inflictor types.
+ **/
+enum /*InflictorType*/
+{
+    Inflictor_Other,              /** Any other entity */
+    Inflictor_Trigger,            /** trigger_* entities, map damage */
+    Inflictor_Hurt,               /** point_hurt entities */
+    Inflictor_Dealer              /** Projectiles and infection entities which carry a weapon id */
+};
+/**
+ * @endsection
+ **/
+
+/**
+ * @brief Amount of edicts which can be an inflictor.
+ **/
+#define HITGROUPS_INFLICTOR_MAX 2048
+
+/**
+ * Array to store the inflictor type of each edict.
+ **/
+int gInflictorType[HITGROUPS_INFLICTOR_MAX];
+
+/**
+ * Bool to check if any damage hint is waiting to be sent.
+ **/
+bool gHintPending;
+
+/**
+ * Bool to check if any knockback is waiting to be applied.
+ **/
+bool gKnockPending;
+
+/**
+ * Custom weapon id of the radius damage in progress, or -1.
+ **/
+int gRadiusWeaponID = -1;
+
+/**
+ * @brief Amount of hits which can be stored for the batched forward within one frame.
+ **/
+#define HITGROUPS_BATCH_MAX 256
+
+/**
+ * @section Batched damage data indexes.
+ **/
+enum /*BatchData*/
+{
+    Batch_Victim,
+    Batch_Attacker,
+    Batch_Inflictor,
+    Batch_Damage,
+    Batch_Bits,
+    Batch_Weapon,
+    
+    Batch_Size
+};
 /**
  * @endsection
  **/
+ 
+/**
+ * Arrays to store the hits for the batched forward.
+ **/
+any gBatchData[Batch_Size][HITGROUPS_BATCH_MAX];
+int gBatchCount;
 
 /**
  * @section Group config data indexes.
@@ -92,6 +144,9 @@ void HitGroupsOnLoad(/*void*/)
     // Register config file
     ConfigRegisterConfig(File_HitGroups, Structure_Keyvalue, CONFIG_FILE_ALIAS_HITGROUPS);
 
+    // Classify entities which were created before the plugin load
+    HitGroupsOnCacheInflictors();
+
     // If hitgroups is disabled, then stop
     if (!gCvarList.HITGROUP.BoolValue)
     {
@@ -137,6 +192,13 @@ void HitGroupsOnLoad(/*void*/)
  **/
 void HitGroupsOnCacheData(/*void*/)
 {
+    // i = hitgroup index
+    for (int i = HITGROUP_GENERIC; i <= HITGROUP_GEAR; i++)
+    {
+        // Clear out the lookup table
+        gServerData.HitGroupsTable[i] = -1;
+    }
+    
     // Gets config file path
     static char sPathGroups[PLATFORM_LINE_LENGTH];
     ConfigGetConfigPath(File_HitGroups, sPathGroups, sizeof(sPathGroups)); 
@@ -152,6 +214,9 @@ void HitGroupsOnCacheData(/*void*/)
         return;
     }
     
+    // Creates the name index
+    gServerData.HitGroupsIndex = ConfigCreateIndex(gServerData.HitGroupsIndex);
+    
     // Validate size
     int iSize = gServerData.HitGroups.Length;
     if (!iSize)
@@ -165,6 +230,7 @@ void HitGroupsOnCacheData(/*void*/)
     {
         // General
         HitGroupsGetName(i, sPathGroups, sizeof(sPathGroups)); // Index: 0
+        ConfigSetIndex(gServerData.HitGroupsIndex, sPathGroups, i);
         kvHitGroups.Rewind();
         if (!kvHitGroups.JumpToKey(sPathGroups))
         {
@@ -184,6 +250,16 @@ void HitGroupsOnCacheData(/*void*/)
         arrayHitGroup.Push(kvHitGroups.GetFloat("heavy", 0.5));                   // Index: 6
         arrayHitGroup.Push(kvHitGroups.GetFloat("shield", 0.5));                  // Index: 7
         arrayHitGroup.Push(ConfigKvGetStringBool(kvHitGroups, "protect", "yes")); // Index: 8
+        
+        // Gets hitgroup index
+        int iHitGroup = HitGroupsGetIndex(i);
+        
+        // Validate the first entry of the engine hitgroup
+        if (iHitGroup >= HITGROUP_GENERIC && iHitGroup <= HITGROUP_GEAR && gServerData.HitGroupsTable[iHitGroup] == -1)
+        {
+            // Store array index in the lookup table
+            gServerData.HitGroupsTable[iHitGroup] = i;
+        }
     }
     
     // We're done with this file now, so we can close it
@@ -263,11 +339,180 @@ void HitGroupsOnClientInit(int client)
 void HitGroupsOnEntityCreated(int entity, const char[] sClassname)
 {
     // Validate entity
-    if (entity > -1 && !strcmp(sClassname[6], "hurt", false))
+    if (entity > -1 && entity < HITGROUPS_INFLICTOR_MAX)
+    {
+        // Store the inflictor type
+        gInflictorType[entity] = HitGroupsGetInflictorType(sClassname);
+        
+        // Validate point_hurt
+        if (gInflictorType[entity] == Inflictor_Hurt)
+        {
+            // Hook entity callbacks
+            SDKHook(entity, SDKHook_SpawnPost, HitGroupsOnHurtSpawn);
+        }
+    }
+}
+
+/**
+ * @brief Stores the inflictor type of all existing edicts.
+ **/
+void HitGroupsOnCacheInflictors(/*void*/)
+{
+    // Initialize name char
+    static char sClassname[SMALL_LINE_LENGTH];
+    
+    // entity = edict index
+    int iSize = min(GetMaxEntities(), HITGROUPS_INFLICTOR_MAX);
+    for (int entity = MaxClients + 1; entity < iSize; entity++)
+    {
+        // Validate edict
+        if (IsValidEdict(entity))
+        {
+            // Store the inflictor type
+            GetEdictClassname(entity, sClassname, sizeof(sClassname));
+            gInflictorType[entity] = HitGroupsGetInflictorType(sClassname);
+        }
+    }
+}
+
+/**
+ * @brief Creates commands for hitgroups module.
+ **/
+void HitGroupsOnCommandInit(/*void*/)
+{
+    // Hook commands
+    RegAdminCmd("zp_knockback_bench", HitGroupsOnCommandCatched, ADMFLAG_CONFIG, "Measures the trace knockback direction against the eye angles one. Blocks the server while running. Usage: zp_knockback_bench [passes]");
+}
+
+/**
+ * @brief Called on each game frame.
+ **/
+void HitGroupsOnFrame(/*void*/)
+{
+    // Forward event to sub-modules
+    HitGroupsOnFrameKnock();
+    HitGroupsOnFrameHints();
+    HitGroupsOnFrameBatch();
+}
+
+/**
+ * @brief Applies the knockback summed within the last tick.
+ **/
+void HitGroupsOnFrameKnock(/*void*/)
+{
+    // If no knockback is waiting, then stop
+    if (!gKnockPending)
+    {
+        return;
+    }
+    
+    // i = client index
+    for (int i = 1; i <= MaxClients; i++)
+    {
+        // Validate knock
+        if (!gClientData[i].KnockPending)
+        {
+            continue;
+        }
+        
+        // Validate client
+        if (IsPlayerExist(i))
+        {
+            // Initialize vector
+            static float vVelocity[3];
+            vVelocity = gClientData[i].KnockVelocity;
+            
+            // Apply multiplier if client on air
+            if (GetEntPropEnt(i, Prop_Send, "m_hGroundEntity") == -1) ScaleVector(vVelocity, gCvarList.HITGROUP_KNOCKBACK_AIR.FloatValue);
+            
+            // Adds the given vector to the client current velocity
+            ToolsSetVelocity(i, vVelocity);
+        }
+        
+        // Resets the knock
+        gClientData[i].KnockVelocity = NULL_VECTOR;
+        gClientData[i].KnockPending = false;
+    }
+    
+    // Update state
+    gKnockPending = false;
+}
+
+/**
+ * @brief Sends the damage hints summed within the interval.
+ **/
+void HitGroupsOnFrameHints(/*void*/)
+{
+    // If no hints are waiting, then stop
+    if (!gHintPending)
+    {
+        return;
+    }
+    
+    // Initialize variables
+    float flTime = GetGameTime(); bool bPending;
+    
+    // i = client index
+    for (int i = 1; i <= MaxClients; i++)
     {
-        // Hook entity callbacks
-        SDKHook(entity, SDKHook_SpawnPost, HitGroupsOnHurtSpawn);
+        // Validate hint
+        if (gClientData[i].HintTime == 0.0)
+        {
+            continue;
+        }
+        
+        // If interval isn't over, then wait
+        if (flTime < gClientData[i].HintTime)
+        {
+            bPending = true;
+            continue;
+        }
+        
+        // Show the summed damage info
+        HitGroupsSendHint(i);
+    }
+    
+    // Update state
+    gHintPending = bPending;
+}
+
+/**
+ * @brief Sends the summed damage hint of the attacker and resets it.
+ *
+ * @param attacker          The attacker index.
+ **/
+void HitGroupsSendHint(int attacker)
+{
+    // Validate client
+    if (IsPlayerExist(attacker, false))
+    {
+        // Show the summed damage info
+        int iArmor = gClientData[attacker].HintArmor;
+        TranslationPrintHintText(attacker, (iArmor > 0) ? "full damage sum info" : "damage sum info", gClientData[attacker].HintDamage, gClientData[attacker].HintHealth, iArmor);
     }
+    
+    // Resets the hint
+    gClientData[attacker].HintVictim = 0;
+    gClientData[attacker].HintDamage = 0;
+    gClientData[attacker].HintTime = 0.0;
+}
+
+/**
+ * @brief Sends the hits stored within the last tick to the batched forward.
+ **/
+void HitGroupsOnFrameBatch(/*void*/)
+{
+    // If no hits are waiting, then stop
+    if (!gBatchCount)
+    {
+        return;
+    }
+    
+    // Resets the batch before the call, hits from the callbacks go to the next one
+    int iCount = gBatchCount; gBatchCount = 0;
+    
+    // Call forward
+    gForwardData._OnClientDamagedBatch(gBatchData[Batch_Victim], gBatchData[Batch_Attacker], gBatchData[Batch_Inflictor], gBatchData[Batch_Damage], gBatchData[Batch_Bits], gBatchData[Batch_Weapon], iCount);
 }
 
 /**
@@ -362,21 +607,14 @@ public Action HitGroupsOnTraceAttack(int client, int &attacker, int &inflictor,
  **/
 public Action HitGroupsOnTakeDamage(int client, int &attacker, int &inflictor, float &flDamage, int &iBits, int &weapon, float damageForce[3], float damagePosition[3]/*, int damagecustom*/)
 {
-    // Initialize name char
-    static char sClassname[SMALL_LINE_LENGTH]; sClassname[0] = NULL_STRING[0];
+    // Gets type of the inflicter
+    int iType = (inflictor > 0 && inflictor < HITGROUPS_INFLICTOR_MAX) ? gInflictorType[inflictor] : Inflictor_Other;
     
-    // Validate inflicter
-    if (IsValidEdict(inflictor))
+    // If entity is a trigger, then allow damage, because map is damaging client
+    if (iType == Inflictor_Trigger)
     {
-        // Gets classname of the inflicter
-        GetEdictClassname(inflictor, sClassname, sizeof(sClassname));
-
-        // If entity is a trigger, then allow damage, because map is damaging client
-        if (!strncmp(sClassname, "trigger", 7, false))
-        {
-            // Allow damage
-            return Plugin_Continue;
-        }
+        // Allow damage
+        return Plugin_Continue;
     }
 
     // If mode doesn't started yet, then stop
@@ -387,7 +625,7 @@ public Action HitGroupsOnTakeDamage(int client, int &attacker, int &inflictor, f
     }
 
     // Validate damage
-    if (!HitGroupsOnCalculateDamage(client, attacker, inflictor, flDamage, iBits, weapon, sClassname))
+    if (!HitGroupsOnCalculateDamage(client, attacker, inflictor, flDamage, iBits, weapon, iType))
     {
         // Block damage
         return Plugin_Handled;
@@ -420,10 +658,10 @@ public void HitGroupsOnHurtSpawn(int entity)
  * @param flDamage          The amount of damage inflicted.
  * @param iBits             The type of damage inflicted.
  * @param weapon            The weapon index or -1 for unspecified.
- * @param sClassname        The classname string.
+ * @param iType             The inflictor type.
  * @return                  True to allow real damage or false to block real damage.
  **/
-bool HitGroupsOnCalculateDamage(int client, int &attacker, int &inflictor, float &flDamage, int &iBits, int &weapon, char[] sClassname)
+bool HitGroupsOnCalculateDamage(int client, int &attacker, int &inflictor, float &flDamage, int &iBits, int &weapon, int iType)
 {
     // Validate victim
     if (!IsPlayerAlive(client))
@@ -433,7 +671,7 @@ bool HitGroupsOnCalculateDamage(int client, int &attacker, int &inflictor, float
     }
     
     // Initialize variables
-    bool bInfectProtect = true; bool bSelfDamage = (client == attacker); bool bHasShield = (WeaponsFindByName(client, "weapon_shield") != -1); bool bHasHeavySuit = ToolsGetHeavySuit(client);
+    bool bInfectProtect = true; bool bSelfDamage = (client == attacker); bool bHasShield = (WeaponsGetShield(client) != -1); bool bHasHeavySuit = ToolsGetHeavySuit(client);
     float flDamageRatio = 1.0; float flArmorRatio = 0.5; float flBonusRatio = 0.5; float flKnockRatio = ClassGetKnockBack(gClientData[client].Class); 
 
     // Gets hitgroup index
@@ -491,7 +729,7 @@ bool HitGroupsOnCalculateDamage(int client, int &attacker, int &inflictor, float
     /*_________________________________________________________________________________________________________________________________________*/
     
     // Validate point_hurt
-    if (!strcmp(sClassname[6], "hurt", false))
+    if (iType == Inflictor_Hurt)
     {
         /// Restore attacker
         attacker = ToolsGetActivator(inflictor);
@@ -532,20 +770,18 @@ bool HitGroupsOnCalculateDamage(int client, int &attacker, int &inflictor, float
         }
 
         /// Validate entity which is inflict damage
-        int dealer = IsValidEdict(weapon) ? weapon : HitGroupsValidateInfclictor(sClassname) ? inflictor : -1;
-        if (dealer != -1)
+        int dealer = IsValidEdict(weapon) ? weapon : (iType >= Inflictor_Hurt) ? inflictor : -1;
+        
+        // Validate custom index
+        int iD = (gRadiusWeaponID != -1) ? gRadiusWeaponID : (dealer != -1) ? WeaponsGetCustomID(dealer) : -1;
+        if (iD != -1)
         {
-            // Validate custom index
-            int iD = WeaponsGetCustomID(dealer);
-            if (iD != -1)
-            {
-                // Add multipliers
-                flDamageRatio *= WeaponsGetDamage(iD); 
-                flKnockRatio  *= WeaponsGetKnockBack(iD);
-                
-                // Store the weapon id for an icon 
-                gClientData[client].LastID = iD;
-            }
+            // Add multipliers
+            flDamageRatio *= WeaponsGetDamage(iD); 
+            flKnockRatio  *= WeaponsGetKnockBack(iD);
+            
+            // Store the weapon id for an icon 
+            gClientData[client].LastID = iD;
         }
     }
     else
@@ -613,7 +849,7 @@ bool HitGroupsOnCalculateDamage(int client, int &attacker, int &inflictor, float
         HitGroupsGiveExp(attacker, iDamage);
         
         // If help messages enabled, then show info
-        if (gCvarList.MESSAGES_DAMAGE.BoolValue) TranslationPrintHintText(attacker, (iArmor > 0) ? "full damage info" : "damage info", (iHealth > 0) ? iHealth : 0, iArmor);
+        if (gCvarList.MESSAGES_DAMAGE.BoolValue) HitGroupsAddHint(attacker, client, iDamage, (iHealth > 0) ? iHealth : 0, iArmor);
 
         // Client was damaged by 'bullet' or 'knife'
         if (iBits & DMG_NEVERGIB)
@@ -663,6 +899,7 @@ bool HitGroupsOnCalculateDamage(int client, int &attacker, int &inflictor, float
     
     // Call forward
     gForwardData._OnClientDamaged(client, attacker, inflictor, flDamage, iBits, weapon, iHealth, iArmor);
+    HitGroupsAddBatch(client, attacker, inflictor, flDamage, iBits, weapon);
     
     // Validate health
     if (iHealth > 0)
@@ -678,6 +915,100 @@ bool HitGroupsOnCalculateDamage(int client, int &attacker, int &inflictor, float
     return true;
 }
 
+/**
+ * @brief Applies damage to all players inside a sphere without a point_hurt entity.
+ *
+ * @note  Same as the engine radius damage, victims behind solid objects are skipped.
+ *        The falloff is measured to the closest point of the victim box, so the victim which was hit directly takes full damage.
+ *
+ * @param vPosition         The center of the sphere.
+ * @param flRadius          The radius of the sphere.
+ * @param flDamage          The amount of damage inflicted.
+ * @param attacker          The attacker index.
+ * @param inflictor         The inflictor index or -1 to use the attacker.
+ * @param bFalloff          If true, damage decreases linearly to zero at the radius.
+ * @param iBits             The type of damage inflicted.
+ * @param iD                The weapon id or -1 for unspecified.
+ * @return                  The amount of damaged players.
+ **/
+int HitGroupsTakeRadiusDamage(float vPosition[3], float flRadius, float flDamage, int attacker, int inflictor, bool bFalloff, int iBits, int iD)
+{
+    // If attacker doesn't exist, then use the world
+    if (!IsValidEdict(attacker)) attacker = 0;
+
+    // If inflictor doesn't exist, then use the attacker
+    if (!IsValidEdict(inflictor)) inflictor = attacker;
+    
+    // Initialize vector variables
+    static float vOrigin[3]; static float vMins[3]; static float vMaxs[3]; static float vCenter[3]; static float vClosest[3];
+    
+    // Store the weapon id for the damage hook, keep the outer one for nested calls
+    int iLastID = gRadiusWeaponID; gRadiusWeaponID = iD;
+
+    // Find players in the sphere
+    int it = 1; int i; int iCount;
+    while ((i = AntiStickFindPlayerInSphere(it, vPosition, flRadius)) != -1)
+    {
+        // Same as point_hurt, never damage the attacker
+        if (i == attacker)
+        {
+            continue;
+        }
+        
+        // Gets the box of the victim
+        GetClientAbsOrigin(i, vOrigin);
+        GetClientMins(i, vMins);
+        GetClientMaxs(i, vMaxs);
+        
+        // x = coordinate index
+        for (int x = 0; x < 3; x++)
+        {
+            // Gets the bounds of the box
+            vMins[x] += vOrigin[x];
+            vMaxs[x] += vOrigin[x];
+            
+            // Gets the center and the closest point of the box
+            vCenter[x] = (vMins[x] + vMaxs[x]) * 0.5;
+            vClosest[x] = (vPosition[x] < vMins[x]) ? vMins[x] : (vPosition[x] > vMaxs[x]) ? vMaxs[x] : vPosition[x];
+        }
+        
+        /// The world can't be ignored, so the trace skips only a real inflictor
+        TR_TraceRayFilter(vPosition, vCenter, MASK_SHOT, RayType_EndPoint, HitGroupsFilter, inflictor ? inflictor : -1);
+        
+        // Validate visibility
+        if (TR_DidHit() && TR_GetEntityIndex() != i)
+        {
+            continue;
+        }
+        
+        // Initialize the amount
+        float flAmount = flDamage;
+        
+        // Validate falloff
+        if (bFalloff)
+        {
+            // Scale the damage by the distance
+            flAmount *= 1.0 - GetVectorDistance(vPosition, vClosest) / flRadius;
+            
+            // Validate amount
+            if (flAmount <= 0.0)
+            {
+                continue;
+            }
+        }
+
+        // Create the damage
+        SDKHooks_TakeDamage(i, inflictor, attacker, flAmount, iBits);
+        iCount++;
+    }
+    
+    // Restore the weapon id
+    gRadiusWeaponID = iLastID;
+    
+    // Return amount
+    return iCount;
+}
+
 /*
  * Hit groups natives API.
  */
@@ -688,6 +1019,8 @@ bool HitGroupsOnCalculateDamage(int client, int &attacker, int &inflictor, float
 void HitGroupsOnNativeInit(/*void*/) 
 {
     CreateNative("ZP_TakeDamage",           API_TakeDamage);
+    CreateNative("ZP_TakeRadiusDamage",     API_TakeRadiusDamage);
+    CreateNative("ZP_SetDamageBatch",       API_SetDamageBatch);
     CreateNative("ZP_GetNumberHitGroup",    API_GetNumberHitGroup);
     CreateNative("ZP_GetHitGroupID",        API_GetHitGroupID);
     CreateNative("ZP_GetHitGroupNameID",    API_GetHitGroupNameID);
@@ -733,7 +1066,73 @@ public int API_TakeDamage(Handle hPlugin, const int iNumParams)
         SDKHooks_TakeDamage(client, inflictor, attacker, flDamage);
     }
 } 
+
+/**
+ * @brief Applies damage to all players inside a sphere.
+ *
+ * @note native int ZP_TakeRadiusDamage(origin, radius, damage, attacker, inflictor, falloff, bits, id);
+ **/
+public int API_TakeRadiusDamage(Handle hPlugin, const int iNumParams)
+{
+    // Gets origin from native cells
+    static float vPosition[3];
+    GetNativeArray(1, vPosition, sizeof(vPosition));
+    
+    // Gets radius from native cells
+    float flRadius = GetNativeCell(2);
+    
+    // Validate radius
+    if (flRadius <= 0.0)
+    {
+        LogEvent(false, LogType_Native, LOG_GAME_EVENTS, LogModule_HitGroups, "Native Validation", "Invalid the radius: %f", flRadius);
+        return 0;
+    }
+    
+    // Gets weapon id from native cells
+    int iD = GetNativeCell(8);
+    
+    // Validate weapon id
+    if (iD != -1 && iD >= gServerData.Weapons.Length)
+    {
+        LogEvent(false, LogType_Native, LOG_GAME_EVENTS, LogModule_HitGroups, "Native Validation", "Invalid the weapon index (%d)", iD);
+        return 0;
+    }
+    
+    // Apply the damage
+    return HitGroupsTakeRadiusDamage(vPosition, flRadius, GetNativeCell(3), GetNativeCell(4), GetNativeCell(5), GetNativeCell(6), GetNativeCell(7), iD);
+}
  
+/**
+ * @brief Subscribes or unsubscribes the plugin from the batched damage forward.
+ *
+ * @note native bool ZP_SetDamageBatch(enable);
+ **/
+public int API_SetDamageBatch(Handle hPlugin, const int iNumParams)
+{
+    // Gets the plugin callback
+    Function hCallback = GetFunctionByName(hPlugin, "ZP_OnClientDamagedBatch");
+    
+    // Validate callback
+    if (hCallback == INVALID_FUNCTION)
+    {
+        LogEvent(false, LogType_Native, LOG_GAME_EVENTS, LogModule_HitGroups, "Native Validation", "Missing the public function: \"ZP_OnClientDamagedBatch\"");
+        return false;
+    }
+    
+    // Gets plugin state
+    bool bEnable = GetNativeCell(1);
+    int iIndex = gForwardData.DamagedBatch.FindValue(hPlugin);
+    
+    // Update the batch list, the per-hit forward is rebuilt on the next hit
+    if (bEnable && iIndex == -1) gForwardData.DamagedBatch.Push(hPlugin);
+    else if (!bEnable && iIndex != -1) gForwardData.DamagedBatch.Erase(iIndex);
+    gForwardData.DamagedDirty = true;
+    
+    // Update the subscription
+    RemoveFromForward(gForwardData.OnClientDamagedBatch, hPlugin, hCallback);
+    return bEnable ? AddToForward(gForwardData.OnClientDamagedBatch, hPlugin, hCallback) : true;
+}
+
 /**
  * @brief Gets the amount of all hitgrups.
  *
@@ -1139,26 +1538,8 @@ bool HitGroupsIsProtect(int iD)
  **/
 int HitGroupsNameToIndex(char[] sName)
 {
-    // Initialize name char
-    static char sHitGroupName[SMALL_LINE_LENGTH];
-    
-    // i = box index
-    int iSize = gServerData.HitGroups.Length;
-    for (int i = 0; i < iSize; i++)
-    {
-        // Gets hitbox name 
-        HitGroupsGetName(i, sHitGroupName, sizeof(sHitGroupName));
-        
-        // If names match, then return index
-        if (!strcmp(sName, sHitGroupName, false))
-        {
-            // Return this index
-            return i;
-        }
-    }
-    
-    // Name doesn't exist
-    return -1;
+    // Gets index from the name index
+    return ConfigGetIndex(gServerData.HitGroupsIndex, sName);
 }
 
 /**
@@ -1169,19 +1550,11 @@ int HitGroupsNameToIndex(char[] sName)
  **/
 int HitGroupToIndex(int iHitGroup)
 {
-    // i = box index
-    int iSize = gServerData.HitGroups.Length;
-    for (int i = 0; i < iSize; i++)
+    // Validate hitgroup index
+    if (iHitGroup >= HITGROUP_GENERIC && iHitGroup <= HITGROUP_GEAR)
     {
-        // Gets hitgroup index at this array index
-        int iIndex = HitGroupsGetIndex(i);
-        
-        // If hitgroup indexes match, then return array index
-        if (iHitGroup == iIndex)
-        {
-            // Return this index
-            return i;
-        }
+        // Return the array index from the lookup table
+        return gServerData.HitGroupsTable[iHitGroup];
     }
     
     // Hitgroup index doesn't exist
@@ -1279,25 +1652,103 @@ bool HitGroupsValidateArmor(int client, int iHitGroup)
 }
 
 /**
- * @brief Returns true if the entity is a projectile, false if not.
+ * @brief Gets the inflictor type from the entity classname.
  *
- * @param inflictor         The inflictor index.
- * @return                  True or false.    
+ * @param sClassname        The classname string.
+ * @return                  The inflictor type.    
  **/
-bool HitGroupsValidateInfclictor(char[] sClassname)
+int HitGroupsGetInflictorType(const char[] sClassname)
 {
     // Gets string length
-    int iLen = strlen(sClassname) - 11;
+    int iLen = strlen(sClassname);
     
-    // Validate length
-    if (iLen > 0)
+    // Validate trigger
+    if (!strncmp(sClassname, "trigger", 7, false))
     {
-        // Validate grenade
-        return (!strncmp(sClassname[iLen], "_proj", 5, false));
+        return Inflictor_Trigger;
+    }
+    
+    // Validate point_hurt
+    if (iLen > 6 && !strcmp(sClassname[6], "hurt", false))
+    {
+        return Inflictor_Hurt;
+    }
+    
+    // Validate grenade
+    if (iLen > 11)
+    {
+        return !strncmp(sClassname[iLen - 11], "_proj", 5, false) ? Inflictor_Dealer : Inflictor_Other;
     }
 
-    // Return on unsuccess
-    return (!strcmp(sClassname[6], "hurt", false) || !strncmp(sClassname, "infe", 4, false));
+    // Validate infection
+    return !strncmp(sClassname, "infe", 4, false) ? Inflictor_Dealer : Inflictor_Other;
+}
+
+/** 
+ * @brief Adds the applied damage to the hint of the attacker.
+ *
+ * @note  Damage is summed per victim, a new victim sends the sum of the previous one.
+ *
+ * @param attacker          The attacker index.
+ * @param client            The victim index.
+ * @param iDamage           The damage amount.
+ * @param iHealth           The health of the victim.
+ * @param iArmor            The armor of the victim.
+ **/
+void HitGroupsAddHint(int attacker, int client, int iDamage, int iHealth, int iArmor)
+{
+    // If victim was changed, then send the sum of the previous one
+    if (gClientData[attacker].HintTime != 0.0 && gClientData[attacker].HintVictim != client)
+    {
+        HitGroupsSendHint(attacker);
+    }
+    
+    // If interval isn't started, then start it
+    if (gClientData[attacker].HintTime == 0.0)
+    {
+        gClientData[attacker].HintTime = GetGameTime() + gCvarList.MESSAGES_DAMAGE_TIME.FloatValue;
+        gClientData[attacker].HintVictim = client;
+        gHintPending = true;
+    }
+    
+    // Sum the damage and keep the victim state
+    gClientData[attacker].HintDamage += iDamage;
+    gClientData[attacker].HintHealth = iHealth;
+    gClientData[attacker].HintArmor = iArmor;
+}
+
+/**
+ * @brief Stores a hit for the batched forward.
+ *
+ * @param client            The victim index.
+ * @param attacker          The attacker index.
+ * @param inflictor         The inflictor index.
+ * @param flDamage          The amount of damage inflicted.
+ * @param iBits             The type of damage inflicted.
+ * @param weapon            The weapon index or -1 for unspecified.
+ **/
+void HitGroupsAddBatch(int client, int attacker, int inflictor, float flDamage, int iBits, int weapon)
+{
+    // Validate subscribers
+    if (!GetForwardFunctionCount(gForwardData.OnClientDamagedBatch))
+    {
+        return;
+    }
+    
+    // If arrays are full, then send them now
+    if (gBatchCount == HITGROUPS_BATCH_MAX)
+    {
+        HitGroupsOnFrameBatch();
+    }
+    
+    // Store the hit
+    gBatchData[Batch_Victim][gBatchCount]    = client;
+    gBatchData[Batch_Attacker][gBatchCount]  = attacker;
+    gBatchData[Batch_Inflictor][gBatchCount] = inflictor;
+    gBatchData[Batch_Damage][gBatchCount]    = flDamage;
+    gBatchData[Batch_Bits][gBatchCount]      = iBits;
+    gBatchData[Batch_Weapon][gBatchCount]    = weapon;
+    gBatchCount++;
 }
 
 /** 
@@ -1314,40 +1765,30 @@ void HitGroupsApplyKnock(int client, int attacker, float flForce)
     {
         return;
     }
-
-    // Apply multiplier if client on air
-    if (GetEntPropEnt(client, Prop_Send, "m_hGroundEntity") == -1) flForce *= gCvarList.HITGROUP_KNOCKBACK_AIR.FloatValue;
     
     // If knockback system is enabled, then apply
     if (gCvarList.HITGROUP_KNOCKBACK.BoolValue) 
     {
         // Initialize vectors
-        static float vPosition[3]; static float vAngle[3]; static float vVelocity[3]; static float vEndPosition[3];
+        static float vAngle[3]; static float vVelocity[3];
 
-        // Gets attacker position
+        // Gets attacker direction, the same as the infinite trace along the eye angles
         GetClientEyeAngles(attacker, vAngle);
-        GetClientEyePosition(attacker, vPosition);
-
-        // Create the infinite trace
-        TR_TraceRayFilter(vPosition, vAngle, MASK_ALL, RayType_Infinite, HitGroupsFilter, attacker);
-
-        // Gets hit point
-        TR_GetEndPosition(vEndPosition);
-
-        // Gets vector from the given starting and ending points
-        MakeVectorFromPoints(vPosition, vEndPosition, vVelocity);
-
-        // Normalize the vector (equal magnitude at varying distances)
-        NormalizeVector(vVelocity, vVelocity);
+        GetAngleVectors(vAngle, vVelocity, NULL_VECTOR, NULL_VECTOR);
 
         // Apply the magnitude by scaling the vector
         ScaleVector(vVelocity, flForce);
 
-        // Adds the given vector to the client current velocity
-        ToolsSetVelocity(client, vVelocity);
+        // Sum the knock within the tick, it is applied on the next frame
+        AddVectors(gClientData[client].KnockVelocity, vVelocity, gClientData[client].KnockVelocity);
+        gClientData[client].KnockPending = true;
+        gKnockPending = true;
     }
     else
     {
+        // Apply multiplier if client on air
+        if (GetEntPropEnt(client, Prop_Send, "m_hGroundEntity") == -1) flForce *= gCvarList.HITGROUP_KNOCKBACK_AIR.FloatValue;
+        
         // Validate max
         if (flForce > 100.0) flForce = 100.0;
         else if (flForce <= 0.0) return;
@@ -1452,4 +1893,80 @@ void HitGroupsGiveExp(int client, int iDamage)
 public bool HitGroupsFilter(int entity, int contentsMask, int client)
 {
     return (entity != client);
-}
\ No newline at end of file
+}
+
+/**
+ * Console command callback (zp_knockback_bench)
+ * @brief Measures the trace knockback direction against the eye angles one.
+ * 
+ * @param client            The client index.
+ * @param iArguments        The number of arguments that were in the argument string.
+ **/ 
+public Action HitGroupsOnCommandCatched(int client, int iArguments)
+{
+    // Initialize variables
+    static char sArgument[SMALL_LINE_LENGTH]; int iPasses = 10000;
+    static float vPosition[3]; static float vAngle[3]; static float vVelocity[3]; static float vEndPosition[3];
+    
+    // Gets amount of passes
+    if (iArguments)
+    {
+        GetCmdArg(1, sArgument, sizeof(sArgument));
+        iPasses = StringToInt(sArgument);
+        if (iPasses < 1) iPasses = 1; else if (iPasses > 1000000) iPasses = 1000000;
+    }
+    
+    // Gets the attacker, the first alive player is used for the server console
+    int attacker = IsPlayerExist(client) ? client : -1;
+    for (int i = 1; i <= MaxClients && attacker == -1; i++)
+    {
+        if (IsPlayerExist(i)) attacker = i;
+    }
+    
+    // If no one is alive, then stop
+    if (attacker == -1)
+    {
+        ReplyToCommand(client, "Benchmark: No alive players to measure from");
+        return Plugin_Handled;
+    }
+    
+    // Start measuring
+    Profiler hProfiler = new Profiler();
+    hProfiler.Start();
+    
+    // i = pass index
+    for (int i = 0; i < iPasses; i++)
+    {
+        // Trace direction
+        GetClientEyeAngles(attacker, vAngle);
+        GetClientEyePosition(attacker, vPosition);
+        TR_TraceRayFilter(vPosition, vAngle, MASK_ALL, RayType_Infinite, HitGroupsFilter, attacker);
+        TR_GetEndPosition(vEndPosition);
+        MakeVectorFromPoints(vPosition, vEndPosition, vVelocity);
+        NormalizeVector(vVelocity, vVelocity);
+    }
+    
+    // Stop measuring
+    hProfiler.Stop();
+    float flTrace = hProfiler.Time;
+    
+    // Start measuring
+    hProfiler.Start();
+    
+    // i = pass index
+    for (int i = 0; i < iPasses; i++)
+    {
+        // Eye angles direction
+        GetClientEyeAngles(attacker, vAngle);
+        GetAngleVectors(vAngle, vVelocity, NULL_VECTOR, NULL_VECTOR);
+    }
+    
+    // Stop measuring
+    hProfiler.Stop();
+    float flAngle = hProfiler.Time;
+    delete hProfiler;
+    
+    // Print results
+    ReplyToCommand(client, "Benchmark: %d passes | Trace: %.3f ms (%.3f us/hit) | Eye angles: %.3f ms (%.3f us/hit)", iPasses, flTrace * 1000.0, flTrace * 1000000.0 / float(iPasses), flAngle * 1000.0, flAngle * 1000000.0 / float(iPasses));
+    return Plugin_Handled;
+}
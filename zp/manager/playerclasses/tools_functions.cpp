@@ -66,6 +66,7 @@ void ToolsOnCvarInit(/*void*/)
     gCvarList.MESSAGES_COUNTER      = FindConVar("zp_messages_counter");
     gCvarList.MESSAGES_BLAST        = FindConVar("zp_messages_blast");
     gCvarList.MESSAGES_DAMAGE       = FindConVar("zp_messages_damage");
+    gCvarList.MESSAGES_DAMAGE_TIME  = FindConVar("zp_messages_damage_interval");
     gCvarList.MESSAGES_DONATE       = FindConVar("zp_messages_donate");
     gCvarList.MESSAGES_CLASS_INFO   = FindConVar("zp_messages_class_info");
     gCvarList.MESSAGES_CLASS_CHOOSE = FindConVar("zp_messages_class_choose");
@@ -116,6 +116,9 @@ void SoundsOnCacheData(/*void*/)
     int iSoundValidCount;
     int iSoundUnValidCount;
     
+    // Creates the key index
+    gServerData.SoundsIndex = ConfigCreateIndex(gServerData.SoundsIndex, true);
+    
     // Validate sound config
     int iSounds = iSoundCount = gServerData.Sounds.Length;
     if (!iSounds)
@@ -163,6 +166,14 @@ void SoundsOnCacheData(/*void*/)
         }
     }
     
+    // i = sound array index
+    for (int i = 0; i < iSounds; i++)
+    {
+        // Push key into index
+        SoundsGetKey(i, sPathSounds, sizeof(sPathSounds));
+        ConfigSetIndex(gServerData.SoundsIndex, sPathSounds, i, true);
+    }
+    
     // Log sound validation info
     LogEvent(true, LogType_Normal, LOG_DEBUG_DETAIL, LogModule_Sounds, "Config Validation", "Total blocks: \"%d\" | Unsuccessful blocks: \"%d\" | Total: %d | Successful: \"%d\" | Unsuccessful: \"%d\"", iSoundCount, iSoundCount - iSounds, iSoundValidCount + iSoundUnValidCount, iSoundValidCount, iSoundUnValidCount);
 }
@@ -621,26 +632,8 @@ void SoundsStopAll(int iKey, int client = -1, int iChannel = SNDCHAN_AUTO)
  **/
 int SoundsKeyToIndex(char[] sKey)
 {
-    // Initialize key char
-    static char sSoundKey[SMALL_LINE_LENGTH]; 
-    
-    // i = block index
-    int iSize = gServerData.Sounds.Length; int iRandom; static int keyID[MAXPLAYERS+1];
-    for (int i = 0; i < iSize; i++)
-    {
-        // Gets sound key 
-        SoundsGetKey(i, sSoundKey, sizeof(sSoundKey));
-        
-        // If keys match, then store index
-        if (!strcmp(sSoundKey, sKey, false))
-        {
-            // Increment amount
-            keyID[iRandom++] = i;
-        }
-    }
-    
-    // Return index
-    return (iRandom) ? keyID[GetRandomInt(0, iRandom-1)] : -1;
+    // Gets random index from the key index
+    return ConfigGetIndex(gServerData.SoundsIndex, sKey, true);
 }
 
 /**
@@ -140,6 +140,7 @@ void WeaponsOnLoad(/*void*/)
     ConfigSetConfigLoaded(File_Weapons, true);
     ConfigSetConfigReloadFunc(File_Weapons, GetFunctionByName(GetMyHandle(), "WeaponsOnConfigReload"));
     ConfigSetConfigHandle(File_Weapons, gServerData.Weapons);
+    ConfigSetConfigIncremental(File_Weapons, true);
     
     // Forward event to sub-modules
     WeaponMODOnLoad();
@@ -177,6 +178,9 @@ void WeaponsOnCacheData(/*void*/)
         gServerData.Entities.Clear();
     }
     
+    // Creates the name index
+    gServerData.WeaponsIndex = ConfigCreateIndex(gServerData.WeaponsIndex);
+    
     // Validate size
     int iSize = gServerData.Weapons.Length;
     if (!iSize)
@@ -193,6 +197,15 @@ void WeaponsOnCacheData(/*void*/)
     {
         // General
         WeaponsGetName(i, sPathWeapons, sizeof(sPathWeapons)); // Index: 0
+        
+        // Skip removed weapons, they keep the data for current owners
+        ConfigEntryState iState = ConfigGetEntryState(File_Weapons, i);
+        if (iState == EntryState_Removed)
+        {
+            continue;
+        }
+        
+        ConfigSetIndex(gServerData.WeaponsIndex, sPathWeapons, i);
         kvWeapons.Rewind();
         if (!kvWeapons.JumpToKey(sPathWeapons))
         {
@@ -210,6 +223,15 @@ void WeaponsOnCacheData(/*void*/)
             continue;
         }
         
+        // Validate unchanged weapon
+        if (iState == EntryState_Keep)
+        {
+            // Register cached entity
+            kvWeapons.GetString("entity", sPathWeapons, sizeof(sPathWeapons), "");
+            gServerData.Entities.SetValue(sPathWeapons, i, false);
+            continue;
+        }
+        
         // Gets array size
         ArrayList arrayWeapon = gServerData.Weapons.Get(i); 
  
@@ -2420,6 +2442,18 @@ void WeaponsSetAnimating(int weapon, float flDelay)
     SetEntPropFloat(weapon, Prop_Send, "m_flTimeWeaponIdle", flDelay);
 }
 
+/**
+ * @brief Returns true if the weapon was removed from the config by a reload.
+ * 
+ * @param iD                The weapon index.
+ * @return                  True or false.
+ **/
+bool WeaponsIsRemoved(int iD)
+{
+    // Gets weapon state
+    return ConfigIsEntryRemoved(File_Weapons, iD);
+}
+
 /**
  * @brief Find the index at which the weapon name is at.
  * 
@@ -2428,26 +2462,8 @@ void WeaponsSetAnimating(int weapon, float flDelay)
  **/
 int WeaponsNameToIndex(char[] sName)
 {
-    // Initialize name char
-    static char sWeaponName[SMALL_LINE_LENGTH];
-    
-    // i = weapon index
-    int iSize = gServerData.Weapons.Length;
-    for (int i = 0; i < iSize; i++)
-    {
-        // Gets weapon name 
-        WeaponsGetName(i, sWeaponName, sizeof(sWeaponName));
-
-        // If names match, then return index
-        if (!strcmp(sName, sWeaponName, false))
-        {
-            // Return this index
-            return i;
-        }
-    }
-    
-    // Name doesn't exist
-    return -1;
+    // Gets index from the name index
+    return ConfigGetIndex(gServerData.WeaponsIndex, sName);
 }
 
 /**
@@ -2805,6 +2821,21 @@ int WeaponsSpawn(int iItem, float vPosition[3] = {0.0, 0.0, 0.0}, float vAngle[3
  * Stocks weapons API.
  */
 
+/**
+ * @brief Returns the shield of the player.
+ *
+ * @param client            The client index.
+ * @return                  The weapon index or -1 if the player has no shield.
+ **/
+int WeaponsGetShield(int client)
+{
+    // Gets weapon index from the reference
+    int weapon = EntRefToEntIndex(gClientData[client].Shield);
+    
+    // Validate owner, weapon can be stripped without a drop
+    return (weapon != -1 && WeaponsGetOwner(weapon) == client) ? weapon : -1;
+}
+
 /**
  * @brief Returns index if the player has a weapon.
  *
@@ -456,7 +456,7 @@ void WeaponAttachSetAddons(int client)
         if (!(gClientData[client].AttachmentBits & CSAddon_Shield))
         {
             // Gets weapon index
-            weapon = WeaponsFindByName(client, "weapon_shield");
+            weapon = WeaponsGetShield(client);
             
             // Validate weapon
             if (weapon != -1)
@@ -352,6 +352,7 @@ void WeaponMODOnClientInit(int client)
     SDKHook(client, SDKHook_WeaponSwitch,     WeaponMODOnDeploy);
     SDKHook(client, SDKHook_WeaponSwitchPost, WeaponMODOnDeployPost);
     SDKHook(client, SDKHook_WeaponEquipPost,  WeaponMODOnEquipPost);
+    SDKHook(client, SDKHook_WeaponDropPost,   WeaponMODOnDropPost);
     SDKHook(client, SDKHook_PostThinkPost,    WeaponMODOnAnimationFix);
 
     // Hook entity callbacks
@@ -1115,6 +1116,17 @@ public void WeaponMODOnEquipPost(int client, int weapon)
     // Validate weapon
     if (IsValidEdict(weapon))
     {
+        // Gets weapon classname
+        static char sClassname[SMALL_LINE_LENGTH];
+        GetEdictClassname(weapon, sClassname, sizeof(sClassname));
+        
+        // Validate shield
+        if (!strcmp(sClassname, "weapon_shield", false))
+        {
+            // Store the client cache
+            gClientData[client].Shield = EntIndexToEntRef(weapon);
+        }
+        
         // Validate custom index
         int iD = WeaponsGetCustomID(weapon);
         if (iD != -1)    
@@ -1130,6 +1142,23 @@ public void WeaponMODOnEquipPost(int client, int weapon)
     }
 }
 
+/**
+ * Hook: WeaponDropPost
+ * @brief Player drop any weapon.
+ *
+ * @param client            The client index.
+ * @param weapon            The weapon index.
+ **/
+public void WeaponMODOnDropPost(int client, int weapon) 
+{
+    // Validate shield
+    if (IsValidEdict(weapon) && EntIndexToEntRef(weapon) == gClientData[client].Shield)
+    {
+        // Clear the client cache
+        gClientData[client].Shield = -1;
+    }
+}
+
 /**
  * Hook: PostThinkPost
  * @brief Player hold any weapon.
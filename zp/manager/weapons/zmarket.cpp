@@ -535,11 +535,8 @@ public int ZMarketMenuSlots1(Menu hMenu, MenuAction mAction, int client, int mSl
                         gClientData[client].DefaultCart.Erase(iIndex);
                     }
                     
-                    // Gets weapon name
-                    WeaponsGetName(iD, sBuffer, sizeof(sBuffer));
-                    
-                    // Remove weapon from the database
-                    DataBaseOnClientUpdate(client, ColumnType_Weapon, FactoryType_Delete, sBuffer);
+                    // Update cart in the database
+                    DataBaseOnClientUpdate(client, ColumnType_Weapon);
                     
                     // Opens market menu back
                     ZMarketMenu(client, "rebuy", MenuType_Option);
@@ -591,15 +588,12 @@ public int ZMarketMenuSlots2(Menu hMenu, MenuAction mAction, int client, int mSl
             static char sBuffer[BIG_LINE_LENGTH];
             hMenu.GetItem(mSlot, sBuffer, sizeof(sBuffer));
             int iD = StringToInt(sBuffer);
-
-            // Gets weapon name
-            WeaponsGetName(iD, sBuffer, sizeof(sBuffer));
             
             // Add index to the history
             gClientData[client].DefaultCart.Push(iD);
 
-            // Insert weapon in the database
-            DataBaseOnClientUpdate(client, ColumnType_Weapon, FactoryType_Insert, sBuffer);
+            // Update cart in the database
+            DataBaseOnClientUpdate(client, ColumnType_Weapon);
             
             // Opens market menu back
             ZMarketMenu(client, "rebuy", MenuType_Option);